@@ -2,7 +2,13 @@ enum
 {
 	IDS_OBJECTDATA_SPLINEDATASPLINE	= 10000,
 	IDS_OBJECTDATA_SPLINEDATAAXISSPLINE,
+	IDS_OBJECTDATA_SPLINEDATAMULTISPLINE,
+	IDS_OBJECTDATA_SPLINEDATAAREA,
+	IDS_OBJECTDATA_SPLINEDATALABEL,
+	IDS_OBJECTDATA_SPLINEDATACHART,
 	IDS_TAGDATA_FACECAMERA,
+	IDS_SCENEHOOK_REGENERATIONSCHEDULER,
+	IDS_MESSAGEDATA_SPLINEDATAREFINEMENT,
 	IDS_COMMANDDATA_SPLINEDATAVIS,
 	IDH_COMMANDDATA_SPLINEDATAVIS,
 
@@ -13,8 +19,7 @@ enum
 	IDS_SPLINEDATAVIS_AXIS_SWEEP,
 	IDS_SPLINEDATAVIS_AXIS_OBJECT,
 	IDS_SPLINEDATAVIS_AXIS_PROFILE,
-	IDS_SPLINEDATAVIS_TEXT_TEXTOBJECT,
-	IDS_SPLINEDATAVIS_TEXT_EXTRUDEOBJECT,
+	IDS_SPLINEDATAVIS_TEXT_LABELOBJECT,
 	IDS_SPLINEDATAVIS_MAT_SPLINEDATA,
 	IDS_SPLINEDATAVIS_MAT_AXIS,
 	IDS_SPLINEDATAVIS_MAT_TEXT,
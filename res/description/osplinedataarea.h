@@ -0,0 +1,20 @@
+#ifndef OSPLINEDATAAREA_H__
+#define OSPLINEDATAAREA_H__
+
+enum
+{
+	OSPLINEDATAAREA_SPLINECURVE = 10000, // SPLINEDATA
+	OSPLINEDATAAREA_WIDTH       = 10001, // FLOAT
+	OSPLINEDATAAREA_HEIGHT      = 10002, // FLOAT
+	OSPLINEDATAAREA_SUBDIVISION = 10003, // INT
+	OSPLINEDATAAREA_BASELINE    = 10004, // FLOAT
+
+	OSPLINEDATAAREA_SCALE       = 10005, // INT
+		OSPLINEDATAAREA_SCALE_LINEAR = 0,
+		OSPLINEDATAAREA_SCALE_LOG10  = 1,
+		OSPLINEDATAAREA_SCALE_SYMLOG = 2,
+	OSPLINEDATAAREA_SCALE_MIN   = 10006, // FLOAT
+	OSPLINEDATAAREA_SCALE_MAX   = 10007  // FLOAT
+};
+
+#endif // OSPLINEDATAAREA_H__
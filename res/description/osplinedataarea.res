@@ -0,0 +1,25 @@
+CONTAINER Osplinedataarea
+{
+	NAME Osplinedataarea;
+	INCLUDE Obase;
+
+	GROUP ID_OBJECTPROPERTIES
+	{
+		SPLINE OSPLINEDATAAREA_SPLINECURVE { }
+		REAL OSPLINEDATAAREA_WIDTH { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATAAREA_HEIGHT { UNIT METER; MIN 0.0; }
+		LONG OSPLINEDATAAREA_SUBDIVISION { MIN 2; MAX 1000; }
+		REAL OSPLINEDATAAREA_BASELINE { }
+		LONG OSPLINEDATAAREA_SCALE
+		{
+			CYCLE
+			{
+				OSPLINEDATAAREA_SCALE_LINEAR;
+				OSPLINEDATAAREA_SCALE_LOG10;
+				OSPLINEDATAAREA_SCALE_SYMLOG;
+			}
+		}
+		REAL OSPLINEDATAAREA_SCALE_MIN { }
+		REAL OSPLINEDATAAREA_SCALE_MAX { }
+	}
+}
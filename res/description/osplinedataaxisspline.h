@@ -3,13 +3,28 @@
 
 enum
 {
-	OSPLINEDATAAXIS_WIDTH           = 10000, // FLOAT
-	OSPLINEDATAAXIS_HEIGHT          = 10001, // FLOAT
-	OSPLINEDATAAXIS_OVERSHOOT       = 10002, // FLOAT
-	OSPLINEDATAAXIS_ARROWS          = 10003, // BOOL
-	OSPLINEDATAAXIS_ARROW_HEIGHT    = 10004, // FLOAT
-	OSPLINEDATAAXIS_ARROW_WIDTH     = 10005, // FLOAT
-	OSPLINEDATAAXIS_ARROW_OVERSHOOT = 10006  // FLOAT
+	OSPLINEDATAAXIS_WIDTH                  = 10000, // FLOAT
+	OSPLINEDATAAXIS_HEIGHT                 = 10001, // FLOAT
+	OSPLINEDATAAXIS_OVERSHOOT              = 10002, // FLOAT
+	OSPLINEDATAAXIS_ARROWS                 = 10003, // BOOL
+	OSPLINEDATAAXIS_ARROW_HEIGHT           = 10004, // FLOAT
+	OSPLINEDATAAXIS_ARROW_WIDTH            = 10005, // FLOAT
+	OSPLINEDATAAXIS_ARROW_OVERSHOOT        = 10006, // FLOAT
+
+	OSPLINEDATAAXIS_TICKS                  = 10007, // BOOL
+	OSPLINEDATAAXIS_TICK_SPACING_X         = 10008, // FLOAT
+	OSPLINEDATAAXIS_TICK_SPACING_Y         = 10009, // FLOAT
+	OSPLINEDATAAXIS_TICK_MINOR_SUBDIVISION = 10010, // INT
+	OSPLINEDATAAXIS_TICK_MAJOR_LENGTH      = 10011, // FLOAT
+	OSPLINEDATAAXIS_TICK_MINOR_LENGTH      = 10012, // FLOAT
+	OSPLINEDATAAXIS_GRID                   = 10013, // BOOL
+
+	OSPLINEDATAAXIS_SCALE                  = 10014, // INT
+		OSPLINEDATAAXIS_SCALE_LINEAR = 0,
+		OSPLINEDATAAXIS_SCALE_LOG10  = 1,
+		OSPLINEDATAAXIS_SCALE_SYMLOG = 2,
+	OSPLINEDATAAXIS_SCALE_MIN              = 10015, // FLOAT
+	OSPLINEDATAAXIS_SCALE_MAX              = 10016  // FLOAT
 };
 
 #endif // OSPLINEDATAAXISSPLINE_H__
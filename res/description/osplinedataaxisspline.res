@@ -13,6 +13,26 @@ CONTAINER Osplinedataaxisspline
 		REAL OSPLINEDATAAXIS_ARROW_HEIGHT { UNIT METER; MIN 0.0; }
 		REAL OSPLINEDATAAXIS_ARROW_WIDTH { UNIT METER; MIN 0.0; }
 		REAL OSPLINEDATAAXIS_ARROW_OVERSHOOT { UNIT METER; MIN 0.0; }
+
+		BOOL OSPLINEDATAAXIS_TICKS {}
+		REAL OSPLINEDATAAXIS_TICK_SPACING_X { UNIT METER; MIN 0.01; }
+		REAL OSPLINEDATAAXIS_TICK_SPACING_Y { UNIT METER; MIN 0.01; }
+		LONG OSPLINEDATAAXIS_TICK_MINOR_SUBDIVISION { MIN 1; MAX 100; }
+		REAL OSPLINEDATAAXIS_TICK_MAJOR_LENGTH { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATAAXIS_TICK_MINOR_LENGTH { UNIT METER; MIN 0.0; }
+		BOOL OSPLINEDATAAXIS_GRID {}
+
+		LONG OSPLINEDATAAXIS_SCALE
+		{
+			CYCLE
+			{
+				OSPLINEDATAAXIS_SCALE_LINEAR;
+				OSPLINEDATAAXIS_SCALE_LOG10;
+				OSPLINEDATAAXIS_SCALE_SYMLOG;
+			}
+		}
+		REAL OSPLINEDATAAXIS_SCALE_MIN { }
+		REAL OSPLINEDATAAXIS_SCALE_MAX { }
 		
 		SEPARATOR { LINE; }
 	}
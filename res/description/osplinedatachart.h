@@ -0,0 +1,32 @@
+#ifndef OSPLINEDATACHART_H__
+#define OSPLINEDATACHART_H__
+
+enum
+{
+	OSPLINEDATACHART_SPLINECURVE            = 10000, // SPLINE
+	OSPLINEDATACHART_WIDTH                  = 10001, // FLOAT
+	OSPLINEDATACHART_HEIGHT                 = 10002, // FLOAT
+	OSPLINEDATACHART_SUBDIVISION            = 10003, // INT
+	OSPLINEDATACHART_SCALE                  = 10004, // INT
+		OSPLINEDATACHART_SCALE_LINEAR = 0,
+		OSPLINEDATACHART_SCALE_LOG10  = 1,
+		OSPLINEDATACHART_SCALE_SYMLOG = 2,
+	OSPLINEDATACHART_SCALE_MIN              = 10005, // FLOAT
+	OSPLINEDATACHART_SCALE_MAX              = 10006, // FLOAT
+
+	OSPLINEDATACHART_OVERSHOOT              = 10007, // FLOAT
+	OSPLINEDATACHART_ARROWS                 = 10008, // BOOL
+	OSPLINEDATACHART_ARROW_HEIGHT           = 10009, // FLOAT
+	OSPLINEDATACHART_ARROW_WIDTH            = 10010, // FLOAT
+	OSPLINEDATACHART_ARROW_OVERSHOOT        = 10011, // FLOAT
+
+	OSPLINEDATACHART_TICKS                  = 10012, // BOOL
+	OSPLINEDATACHART_TICK_SPACING_X         = 10013, // FLOAT
+	OSPLINEDATACHART_TICK_SPACING_Y         = 10014, // FLOAT
+	OSPLINEDATACHART_TICK_MINOR_SUBDIVISION = 10015, // INT
+	OSPLINEDATACHART_TICK_MAJOR_LENGTH      = 10016, // FLOAT
+	OSPLINEDATACHART_TICK_MINOR_LENGTH      = 10017, // FLOAT
+	OSPLINEDATACHART_GRID                   = 10018  // BOOL
+};
+
+#endif // OSPLINEDATACHART_H__
@@ -0,0 +1,42 @@
+CONTAINER Osplinedatachart
+{
+	NAME Osplinedatachart;
+	INCLUDE Obase;
+
+	GROUP ID_OBJECTPROPERTIES
+	{
+		SPLINE OSPLINEDATACHART_SPLINECURVE { }
+		REAL OSPLINEDATACHART_WIDTH { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATACHART_HEIGHT { UNIT METER; MIN 0.0; }
+		LONG OSPLINEDATACHART_SUBDIVISION { MIN 2; MAX 1000; }
+		LONG OSPLINEDATACHART_SCALE
+		{
+			CYCLE
+			{
+				OSPLINEDATACHART_SCALE_LINEAR;
+				OSPLINEDATACHART_SCALE_LOG10;
+				OSPLINEDATACHART_SCALE_SYMLOG;
+			}
+		}
+		REAL OSPLINEDATACHART_SCALE_MIN { }
+		REAL OSPLINEDATACHART_SCALE_MAX { }
+		SEPARATOR { LINE; }
+
+		REAL OSPLINEDATACHART_OVERSHOOT { UNIT METER; }
+		BOOL OSPLINEDATACHART_ARROWS {}
+		REAL OSPLINEDATACHART_ARROW_HEIGHT { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATACHART_ARROW_WIDTH { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATACHART_ARROW_OVERSHOOT { UNIT METER; MIN 0.0; }
+
+		BOOL OSPLINEDATACHART_TICKS {}
+		REAL OSPLINEDATACHART_TICK_SPACING_X { UNIT METER; MIN 0.01; }
+		REAL OSPLINEDATACHART_TICK_SPACING_Y { UNIT METER; MIN 0.01; }
+		LONG OSPLINEDATACHART_TICK_MINOR_SUBDIVISION { MIN 1; MAX 100; }
+		REAL OSPLINEDATACHART_TICK_MAJOR_LENGTH { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATACHART_TICK_MINOR_LENGTH { UNIT METER; MIN 0.0; }
+		BOOL OSPLINEDATACHART_GRID {}
+
+		SEPARATOR { LINE; }
+	}
+	INCLUDE Ospline;
+}
@@ -0,0 +1,16 @@
+#ifndef OSPLINEDATALABEL_H__
+#define OSPLINEDATALABEL_H__
+
+enum
+{
+	OSPLINEDATALABEL_TEXT   = 10000, // STRING
+	OSPLINEDATALABEL_FONT   = 10001, // FONT
+	OSPLINEDATALABEL_HEIGHT = 10002, // FLOAT
+	OSPLINEDATALABEL_DEPTH  = 10003, // FLOAT
+	OSPLINEDATALABEL_ALIGN  = 10004, // INT
+		OSPLINEDATALABEL_ALIGN_LEFT   = 0,
+		OSPLINEDATALABEL_ALIGN_CENTER = 1,
+		OSPLINEDATALABEL_ALIGN_RIGHT  = 2
+};
+
+#endif // OSPLINEDATALABEL_H__
@@ -0,0 +1,22 @@
+CONTAINER Osplinedatalabel
+{
+	NAME Osplinedatalabel;
+	INCLUDE Obase;
+
+	GROUP ID_OBJECTPROPERTIES
+	{
+		STRING OSPLINEDATALABEL_TEXT { CUSTOMGUI MULTISTRING; }
+		FONT OSPLINEDATALABEL_FONT { }
+		REAL OSPLINEDATALABEL_HEIGHT { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATALABEL_DEPTH { UNIT METER; MIN 0.0; }
+		LONG OSPLINEDATALABEL_ALIGN
+		{
+			CYCLE
+			{
+				OSPLINEDATALABEL_ALIGN_LEFT;
+				OSPLINEDATALABEL_ALIGN_CENTER;
+				OSPLINEDATALABEL_ALIGN_RIGHT;
+			}
+		}
+	}
+}
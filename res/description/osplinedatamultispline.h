@@ -0,0 +1,23 @@
+#ifndef OSPLINEDATAMULTISPLINE_H__
+#define OSPLINEDATAMULTISPLINE_H__
+
+enum
+{
+	OSPLINEDATAMULTI_WIDTH         = 10000, // FLOAT
+	OSPLINEDATAMULTI_HEIGHT        = 10001, // FLOAT
+	OSPLINEDATAMULTI_SUBDIVISION   = 10002, // INT
+	OSPLINEDATAMULTI_SERIES_COUNT  = 10003, // INT
+
+	OSPLINEDATAMULTI_SPLINECURVE_0 = 10100, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_1 = 10101, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_2 = 10102, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_3 = 10103, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_4 = 10104, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_5 = 10105, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_6 = 10106, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_7 = 10107, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_8 = 10108, // SPLINEDATA
+	OSPLINEDATAMULTI_SPLINECURVE_9 = 10109  // SPLINEDATA
+};
+
+#endif // OSPLINEDATAMULTISPLINE_H__
@@ -0,0 +1,27 @@
+CONTAINER Osplinedatamultispline
+{
+	NAME Osplinedatamultispline;
+	INCLUDE Obase;
+
+	GROUP ID_OBJECTPROPERTIES
+	{
+		REAL OSPLINEDATAMULTI_WIDTH { UNIT METER; MIN 0.0; }
+		REAL OSPLINEDATAMULTI_HEIGHT { UNIT METER; MIN 0.0; }
+		LONG OSPLINEDATAMULTI_SUBDIVISION { MIN 2; MAX 1000; }
+		LONG OSPLINEDATAMULTI_SERIES_COUNT { MIN 1; MAX 10; }
+		SEPARATOR { LINE; }
+
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_0 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_1 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_2 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_3 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_4 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_5 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_6 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_7 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_8 { }
+		SPLINE OSPLINEDATAMULTI_SPLINECURVE_9 { }
+		SEPARATOR { LINE; }
+	}
+	INCLUDE Ospline;
+}
@@ -3,10 +3,39 @@
 
 enum
 {
-	OSPLINEDATA_SPLINECURVE = 10000, // SPLINEDATA
-	OSPLINEDATA_WIDTH       = 10001, // FLOAT
-	OSPLINEDATA_HEIGHT      = 10002, // FLOAT
-	OSPLINEDATA_SUBDIVISION = 10003  // INT
+	OSPLINEDATA_SPLINECURVE       = 10000, // SPLINEDATA
+	OSPLINEDATA_WIDTH             = 10001, // FLOAT
+	OSPLINEDATA_HEIGHT            = 10002, // FLOAT
+	OSPLINEDATA_SUBDIVISION       = 10003, // INT
+
+	OSPLINEDATA_MORPH             = 10004, // BOOL
+	OSPLINEDATA_MORPH_SPLINECURVE = 10005, // SPLINEDATA
+	OSPLINEDATA_MORPH_BLEND       = 10006, // FLOAT
+
+	OSPLINEDATA_RANGE_START       = 10007, // FLOAT
+	OSPLINEDATA_RANGE_END         = 10008, // FLOAT
+
+	OSPLINEDATA_SCALE             = 10009, // INT
+		OSPLINEDATA_SCALE_LINEAR = 0,
+		OSPLINEDATA_SCALE_LOG10  = 1,
+		OSPLINEDATA_SCALE_SYMLOG = 2,
+	OSPLINEDATA_SCALE_MIN         = 10010, // FLOAT
+	OSPLINEDATA_SCALE_MAX         = 10011, // FLOAT
+
+	OSPLINEDATA_DERIVATIVE        = 10012, // BOOL
+	OSPLINEDATA_DERIVATIVE_SCALE  = 10013, // FLOAT
+	OSPLINEDATA_INTEGRAL          = 10014, // BOOL
+	OSPLINEDATA_INTEGRAL_SCALE    = 10015, // FLOAT
+
+	OSPLINEDATA_LAYOUT            = 10016, // INT
+		OSPLINEDATA_LAYOUT_CARTESIAN = 0,
+		OSPLINEDATA_LAYOUT_POLAR     = 1,
+	OSPLINEDATA_POLAR_START_ANGLE = 10017, // FLOAT
+	OSPLINEDATA_POLAR_SWEEP       = 10018, // FLOAT
+
+	OSPLINEDATA_TIME_BUDGET       = 10019, // INT
+
+	OSPLINEDATA_TANGENTS          = 10020  // BOOL
 };
 
 #endif // OSPLINEDATASPLINE_H__
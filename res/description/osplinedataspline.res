@@ -9,7 +9,46 @@ CONTAINER Osplinedataspline
 		REAL OSPLINEDATA_WIDTH { UNIT METER; MIN 0.0; }
 		REAL OSPLINEDATA_HEIGHT { UNIT METER; MIN 0.0; }
 		LONG OSPLINEDATA_SUBDIVISION { MIN 2; MAX 1000; }
+		LONG OSPLINEDATA_TIME_BUDGET { MIN 1; MAX 1000; }
+		REAL OSPLINEDATA_RANGE_START { UNIT PERCENT; MIN 0.0; MAX 100.0; }
+		REAL OSPLINEDATA_RANGE_END { UNIT PERCENT; MIN 0.0; MAX 100.0; }
+		LONG OSPLINEDATA_SCALE
+		{
+			CYCLE
+			{
+				OSPLINEDATA_SCALE_LINEAR;
+				OSPLINEDATA_SCALE_LOG10;
+				OSPLINEDATA_SCALE_SYMLOG;
+			}
+		}
+		REAL OSPLINEDATA_SCALE_MIN { }
+		REAL OSPLINEDATA_SCALE_MAX { }
 		SEPARATOR { LINE; }
+
+		LONG OSPLINEDATA_LAYOUT
+		{
+			CYCLE
+			{
+				OSPLINEDATA_LAYOUT_CARTESIAN;
+				OSPLINEDATA_LAYOUT_POLAR;
+			}
+		}
+		REAL OSPLINEDATA_POLAR_START_ANGLE { UNIT DEGREE; }
+		REAL OSPLINEDATA_POLAR_SWEEP { UNIT DEGREE; MIN -360.0; MAX 360.0; }
+		SEPARATOR { LINE; }
+
+		BOOL OSPLINEDATA_MORPH {}
+		SPLINE OSPLINEDATA_MORPH_SPLINECURVE { }
+		REAL OSPLINEDATA_MORPH_BLEND { UNIT PERCENT; MIN 0.0; MAX 100.0; CUSTOMGUI REALSLIDER; }
+		SEPARATOR { LINE; }
+
+		BOOL OSPLINEDATA_DERIVATIVE {}
+		REAL OSPLINEDATA_DERIVATIVE_SCALE { UNIT PERCENT; }
+		BOOL OSPLINEDATA_INTEGRAL {}
+		REAL OSPLINEDATA_INTEGRAL_SCALE { UNIT PERCENT; }
+		SEPARATOR { LINE; }
+
+		BOOL OSPLINEDATA_TANGENTS {}
 	}
 	INCLUDE Ospline;
 }
@@ -72,11 +72,8 @@ public:
 		BaseObject *axisProfile = BaseObject::Alloc(Osplinecircle);
 		if (!splineDataProfile || !axisProfile)
 			return false;
-		BaseObject *textObject = BaseObject::Alloc(Osplinetext);
-		if (!textObject)
-			return false;
-		BaseObject *textExtrudeObject = BaseObject::Alloc(Oextrude);
-		if (!textExtrudeObject)
+		BaseObject *textLabelObject = BaseObject::Alloc(SplineDataVisualizationHelpers::ID_OBJECTDATA_SPLINEDATALABEL);
+		if (!textLabelObject)
 			return false;
 
 		// Set profile splines' attributes
@@ -87,16 +84,8 @@ public:
 		splineDataProfileDataPtr->SetFloat(PRIM_CIRCLE_RADIUS, SplineDataVisualizationHelpers::DEFAULT_VIS_SPLINEDATA_PROFILE_RADIUS);
 		axisProfileDataPtr->SetFloat(PRIM_CIRCLE_RADIUS, SplineDataVisualizationHelpers::DEFAULT_VIS_AXIS_PROFILE_RADIUS);
 
-		// Set text properties
-		BaseContainer *textObjectDataPtr = textObject->GetDataInstance();
-		BaseContainer *textExtrudeDataPtr = textExtrudeObject->GetDataInstance();
-		if (!textObjectDataPtr || !textExtrudeDataPtr)
-			return false;
-		textObjectDataPtr->SetInt32(PRIM_PLANE, PRIM_PLANE_XY);
-		textObjectDataPtr->SetString(PRIM_TEXT_TEXT, GeLoadString(IDS_SPLINEDATAVIS_TEXT_DEFAULT));
-		textObjectDataPtr->SetFloat(PRIM_TEXT_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_HEIGHT);
-		textExtrudeDataPtr->SetVector(EXTRUDEOBJECT_MOVE, Vector(0.0, 0.0, SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_DEPTH));
-		textExtrudeObject->SetAbsPos(Vector(0.0, -SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_HEIGHT - SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_OFFSET, 0.0));
+		// Set text properties. The label is built from cached glyphs, and initializes text, height and depth itself.
+		textLabelObject->SetAbsPos(Vector(0.0, -SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_HEIGHT - SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_OFFSET, 0.0));
 
 		// Set objects' names
 		groupObject->SetName(GeLoadString(IDS_SPLINEDATAVIS_GROUPOBJ));
@@ -106,12 +95,10 @@ public:
 		axisSweepObject->SetName(GeLoadString(IDS_SPLINEDATAVIS_AXIS_SWEEP));
 		axisSplineObject->SetName(GeLoadString(IDS_SPLINEDATAVIS_AXIS_OBJECT));
 		axisProfile->SetName(GeLoadString(IDS_SPLINEDATAVIS_AXIS_PROFILE));
-		textObject->SetName(GeLoadString(IDS_SPLINEDATAVIS_TEXT_TEXTOBJECT));
-		textExtrudeObject->SetName(GeLoadString(IDS_SPLINEDATAVIS_TEXT_EXTRUDEOBJECT));
+		textLabelObject->SetName(GeLoadString(IDS_SPLINEDATAVIS_TEXT_LABELOBJECT));
 
 		// Create object hierarchy
-		textExtrudeObject->InsertUnder(groupObject);
-		textObject->InsertUnder(textExtrudeObject);
+		textLabelObject->InsertUnder(groupObject);
 		axisSweepObject->InsertUnder(groupObject);
 		axisSplineObject->InsertUnder(axisSweepObject);
 		axisProfile->InsertUnder(axisSweepObject);
@@ -158,10 +145,10 @@ public:
 		if (!textureTagSweep2)
 			return false;
 		textureTagSweep2->SetMaterial(axisMat);
-		TextureTag *textureTagExtrude = static_cast<TextureTag*>(textExtrudeObject->MakeTag(Ttexture));
-		if (!textureTagExtrude)
+		TextureTag *textureTagLabel = static_cast<TextureTag*>(textLabelObject->MakeTag(Ttexture));
+		if (!textureTagLabel)
 			return false;
-		textureTagExtrude->SetMaterial(textMat);
+		textureTagLabel->SetMaterial(textMat);
 
 		// Add Face Camera expression tag
 		BaseTag *faceCameraTag = groupObject->MakeTag(SplineDataVisualizationHelpers::ID_FACECAMERA);
@@ -175,12 +162,11 @@ public:
 		splineDataSplineObject->Message(MSG_UPDATE);
 		splineDataProfile->Message(MSG_UPDATE);
 		splineDataSweepObject->Message(MSG_UPDATE);
-		textObject->Message(MSG_UPDATE);
-		textExtrudeObject->Message(MSG_UPDATE);
+		textLabelObject->Message(MSG_UPDATE);
 		groupObject->Message(MSG_UPDATE);
 		textureTagSweep->Message(MSG_UPDATE);
 		textureTagSweep2->Message(MSG_UPDATE);
-		textureTagExtrude->Message(MSG_UPDATE);
+		textureTagLabel->Message(MSG_UPDATE);
 		splineDataMat->Message(MSG_UPDATE);
 		axisMat->Message(MSG_UPDATE);
 		textMat->Message(MSG_UPDATE);
@@ -9,13 +9,45 @@ namespace SplineDataVisualizationHelpers
 	static const Int32 ID_COMMANDDATA_SPLINEDATAVIS = 1054272;
 	static const Int32 ID_SPLINEDATAVIS_SEPARATOR = 1054273;
 	static const Int32 ID_FACECAMERA = 1054290;
+	static const Int32 ID_OBJECTDATA_SPLINEDATAMULTISPLINE = 1054291;
+	static const Int32 ID_OBJECTDATA_SPLINEDATAAREA = 1054292;
+	static const Int32 ID_OBJECTDATA_SPLINEDATALABEL = 1054293;
+	static const Int32 ID_SCENEHOOK_REGENERATIONSCHEDULER = 1054294;
+	static const Int32 ID_OBJECTDATA_SPLINEDATACHART = 1054295;
+	static const Int32 ID_MESSAGEDATA_SPLINEDATAREFINEMENT = 1054296;
+
+	// Disk levels
+	static const Int32 DISKLEVEL_SPLINEDATASPLINE_CONTOUR = 1;
 
 	// General defaults
 	const Float DEFAULT_WIDTH = 200.0;
 	const Float DEFAULT_HEIGHT = 50.0;
 
+	// Scale defaults
+	const Float DEFAULT_SCALE_MIN = 0.0;
+	const Float DEFAULT_SCALE_MAX = 1.0;
+
 	// SplineDataSpline defaults
 	const UInt32 DEFAULT_SPLINEDATA_SUBDIVISION = 100;
+	const Int32 DEFAULT_SPLINEDATA_TIME_BUDGET = 20;
+	const Float MIN_VISIBLE_RANGE = 0.001;
+	const Float DEFAULT_OVERLAY_SCALE = 1.0;
+	const Float DEFAULT_POLAR_SWEEP = PI2;
+	/// Distance between a sample and the curve evaluations for its slope, relative to the
+	/// spacing of the samples (the visible range divided by the number of intervals). Slopes
+	/// are central differences, accurate to about (step^2 / 6) times the curve's third
+	/// derivative; only the samples at 0.0 and 1.0 use one-sided three-point differences,
+	/// accurate to about (step^2 / 3) times the third derivative. The step is far below the
+	/// sample spacing, and large enough that rounding in the curve evaluation stays below
+	/// Float32 precision.
+	const Float SLOPE_DIFFERENCE_STEP = 0.01;
+
+	// SplineDataMultiSpline defaults
+	const Int32 MULTISPLINE_MAX_SERIES = 10;
+	const Int32 DEFAULT_MULTISPLINE_SERIES = 2;
+
+	// SplineDataArea defaults
+	const Float DEFAULT_AREA_BASELINE = 0.0;
 
 	// SplineDataAxis defaults
 	const Float DEFAULT_AXIS_OVERSHOOT = 2.0;
@@ -23,6 +55,13 @@ namespace SplineDataVisualizationHelpers
 	const Float DEFAULT_AXIS_ARROW_HEIGHT = 5.0;
 	const Float DEFAULT_AXIS_ARROW_WIDTH = 5.0;
 	const Float DEFAULT_AXIS_ARROW_OVERSHOOT = 10.0;
+	const Bool DEFAULT_AXIS_TICKS = false;
+	const Float DEFAULT_AXIS_TICK_SPACING_X = 50.0;
+	const Float DEFAULT_AXIS_TICK_SPACING_Y = 25.0;
+	const Int32 DEFAULT_AXIS_TICK_MINOR_SUBDIVISION = 5;
+	const Float DEFAULT_AXIS_TICK_MAJOR_LENGTH = 3.0;
+	const Float DEFAULT_AXIS_TICK_MINOR_LENGTH = 1.5;
+	const Bool DEFAULT_AXIS_GRID = false;
 
 	// Visualization components defaults
 	const Float DEFAULT_VIS_SPLINEDATA_PROFILE_RADIUS = 0.5;
@@ -33,6 +72,11 @@ namespace SplineDataVisualizationHelpers
 	const Float DEFAULT_VIS_TEXT_HEIGHT = 15.0;
 	const Float DEFAULT_VIS_TEXT_OFFSET = 2.0;
 	const Float DEFAULT_VIS_TEXT_DEPTH = 0.0;
+
+	// SplineDataLabel layout, relative to the text height
+	const Float LABEL_LINE_SPACING = 1.2;
+	const Float LABEL_SPACE_ADVANCE = 0.3;
+	const Float LABEL_GLYPH_GAP = 0.08;
 }
 
 #endif // COMMONS_H__
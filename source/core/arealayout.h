@@ -0,0 +1,101 @@
+#ifndef CORE_AREALAYOUT_H__
+#define CORE_AREALAYOUT_H__
+
+// This header does not depend on the Cinema 4D API.
+#include <cstdint>
+
+
+namespace SplineDataVisualizationHelpers
+{
+	/// \brief Returns the number of intervals in which a curve crosses the baseline
+	template <typename VECTOR>
+	int64_t CountBaselineCrossings(const VECTOR *curvePoints, int64_t count, double baselineY)
+	{
+		int64_t crossingCount = 0;
+		for (int64_t pointIndex = 0; pointIndex + 1 < count; ++pointIndex)
+		{
+			if ((curvePoints[pointIndex].y - baselineY) * (curvePoints[pointIndex + 1].y - baselineY) < 0.0)
+				++crossingCount;
+		}
+		return crossingCount;
+	}
+
+	/// \brief Return number of required points for the area below a curve
+	inline int64_t GetNumberOfRequiredAreaPoints(int64_t count, int64_t crossingCount)
+	{
+		return count * 2 + crossingCount;
+	}
+
+	/// \brief Return number of required polygons for the area below a curve
+	inline int64_t GetNumberOfRequiredAreaPolygons(int64_t count, int64_t crossingCount)
+	{
+		return count > 1 ? count - 1 + crossingCount : 0;
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Writes a polygon strip filling the area between a curve and a horizontal baseline.
+	/// As the curve is a function of x, every interval between two samples becomes one quad.
+	/// Where the curve crosses the baseline, the interval is split into two triangles at the
+	/// crossing point instead, so no polygon intersects itself. All polygons face -z.
+	/// Point layout: curve points, then baseline points, then crossing points.
+	/// @brief Writes a polygon strip filling the area between a curve and a baseline.
+	/// @param[in] curvePoints				The curve's points, ordered by x
+	/// @param[in] count							Number of curve points
+	/// @param[in] baselineY					Height of the baseline
+	/// @param[out] points						Array of GetNumberOfRequiredAreaPoints() points, VECTOR must be constructible from (x, y, z)
+	/// @param[out] polygons					Array of GetNumberOfRequiredAreaPolygons() polygons, POLYGON must be constructible from (a, b, c, d)
+	//----------------------------------------------------------------------------------------
+	template <typename VECTOR, typename POLYGON>
+	void WriteSplineDataAreaMesh(const VECTOR *curvePoints, int64_t count, double baselineY, VECTOR *points, POLYGON *polygons)
+	{
+		for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+		{
+			points[pointIndex] = curvePoints[pointIndex];
+			points[count + pointIndex] = VECTOR(curvePoints[pointIndex].x, baselineY, 0.0);
+		}
+
+		int32_t crossingIndex = (int32_t)(count * 2);
+		int64_t polygonIndex = 0;
+		for (int64_t pointIndex = 0; pointIndex + 1 < count; ++pointIndex)
+		{
+			const int32_t topLeft = (int32_t)pointIndex;
+			const int32_t topRight = topLeft + 1;
+			const int32_t bottomLeft = (int32_t)(count + pointIndex);
+			const int32_t bottomRight = bottomLeft + 1;
+			const double deltaLeft = curvePoints[pointIndex].y - baselineY;
+			const double deltaRight = curvePoints[pointIndex + 1].y - baselineY;
+
+			if (deltaLeft * deltaRight < 0.0)
+			{
+				// Split at the crossing point, one triangle on each side of the baseline
+				const double t = deltaLeft / (deltaLeft - deltaRight);
+				const double x = curvePoints[pointIndex].x + (curvePoints[pointIndex + 1].x - curvePoints[pointIndex].x) * t;
+				points[crossingIndex] = VECTOR(x, baselineY, 0.0);
+
+				if (deltaLeft > 0.0)
+					polygons[polygonIndex++] = POLYGON(topLeft, crossingIndex, bottomLeft, bottomLeft);
+				else
+					polygons[polygonIndex++] = POLYGON(bottomLeft, crossingIndex, topLeft, topLeft);
+
+				if (deltaRight > 0.0)
+					polygons[polygonIndex++] = POLYGON(crossingIndex, topRight, bottomRight, bottomRight);
+				else
+					polygons[polygonIndex++] = POLYGON(crossingIndex, bottomRight, topRight, topRight);
+
+				++crossingIndex;
+			}
+			else if (deltaLeft + deltaRight >= 0.0)
+			{
+				// Curve above the baseline
+				polygons[polygonIndex++] = POLYGON(topLeft, topRight, bottomRight, bottomLeft);
+			}
+			else
+			{
+				// Curve below the baseline
+				polygons[polygonIndex++] = POLYGON(bottomLeft, bottomRight, topRight, topLeft);
+			}
+		}
+	}
+}
+
+#endif // CORE_AREALAYOUT_H__
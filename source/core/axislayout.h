@@ -0,0 +1,290 @@
+#ifndef CORE_AXISLAYOUT_H__
+#define CORE_AXISLAYOUT_H__
+
+// This header does not depend on the Cinema 4D API, it is shared with the command line renderer.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "scalemapping.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	// Axis constants
+	const int32_t MAX_AXIS_TICKS = 10000;
+
+	//----------------------------------------------------------------------------------------
+	/// Struct to hold the geometric parameters of a coordinate system
+	//----------------------------------------------------------------------------------------
+	struct SplineDataAxisLayoutParameters
+	{
+		double height;
+		double width;
+		double overshoot;
+		bool arrows;
+		double arrowHeight;
+		double arrowWidth;
+		double arrowOvershoot;
+		bool ticks;
+		double tickSpacingX;
+		double tickSpacingY;
+		ScaleMapping scaleY;
+		int32_t tickMinorSubdivision;
+		double tickMajorLength;
+		double tickMinorLength;
+		bool grid;
+
+		/// \brief Default constructor
+		SplineDataAxisLayoutParameters() : height(0.0), width(0.0), overshoot(0.0), arrows(false),
+			arrowHeight(0.0), arrowWidth(0.0), arrowOvershoot(0.0),
+			ticks(false), tickSpacingX(0.0), tickSpacingY(0.0), scaleY(), tickMinorSubdivision(1),
+			tickMajorLength(0.0), tickMinorLength(0.0), grid(false)
+		{
+		}
+
+		/// \brief Contruct from values
+		SplineDataAxisLayoutParameters(double _height,
+																	 double _width,
+																	 double _overshoot,
+																	 bool _arrows,
+																	 double _arrowHeight,
+																	 double _arrowWidth,
+																	 double _arrowOvershoot,
+																	 bool _ticks,
+																	 double _tickSpacingX,
+																	 double _tickSpacingY,
+																	 const ScaleMapping &_scaleY,
+																	 int32_t _tickMinorSubdivision,
+																	 double _tickMajorLength,
+																	 double _tickMinorLength,
+																	 bool _grid) :
+			height(_height), width(_width),
+			overshoot(_overshoot), arrows(_arrows),
+			arrowHeight(_arrowHeight), arrowWidth(_arrowWidth),
+			arrowOvershoot(_arrowOvershoot),
+			ticks(_ticks), tickSpacingX(_tickSpacingX),
+			tickSpacingY(_tickSpacingY), scaleY(_scaleY),
+			tickMinorSubdivision(std::max(_tickMinorSubdivision, (int32_t)1)),
+			tickMajorLength(_tickMajorLength), tickMinorLength(_tickMinorLength),
+			grid(_grid)
+		{
+		}
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Number of ticks and grid lines along both axes, computed up front so the
+	/// whole axis system fits into one SplineObject allocation.
+	//----------------------------------------------------------------------------------------
+	struct SplineDataAxisTickLayout
+	{
+		int32_t ticksX;       ///< Number of tick positions along the x axis (major and minor)
+		int32_t ticksY;       ///< Number of tick positions along the y axis (major and minor)
+		int32_t gridLinesX;   ///< Number of vertical grid lines (at major ticks along the x axis)
+		int32_t gridLinesY;   ///< Number of horizontal grid lines (at major ticks along the y axis)
+
+		/// \brief Default constructor
+		SplineDataAxisTickLayout() : ticksX(0), ticksY(0), gridLinesX(0), gridLinesY(0)
+		{
+		}
+
+		/// \brief Returns the total number of two-point segments
+		int32_t GetSegmentCount() const
+		{
+			return ticksX + ticksY + gridLinesX + gridLinesY;
+		}
+	};
+
+	/// \brief Returns the number of tick positions along an axis, not counting the origin
+	inline int32_t GetAxisTickCount(double axisLength, double majorSpacing, int32_t minorSubdivision)
+	{
+		if (axisLength <= 0.0 || majorSpacing <= 0.0 || minorSubdivision < 1)
+			return 0;
+		const double minorSpacing = majorSpacing / (double)minorSubdivision;
+		return (int32_t)std::min(std::floor(axisLength / minorSpacing + 1.0e-6), (double)MAX_AXIS_TICKS);
+	}
+
+	/// \brief Computes the tick and grid line counts for a parameter set. For non-linear scales, this walks all ticks, so it is computed once per layout.
+	inline SplineDataAxisTickLayout GetAxisTickLayout(const SplineDataAxisLayoutParameters &params)
+	{
+		SplineDataAxisTickLayout layout;
+		if (!params.ticks && !params.grid)
+			return layout;
+
+		const int32_t ticksX = GetAxisTickCount(params.width, params.tickSpacingX, params.tickMinorSubdivision);
+		int32_t ticksY = 0;
+		int32_t majorTicksY = 0;
+		if (params.scaleY.GetType() == SCALETYPE::LINEAR)
+		{
+			ticksY = GetAxisTickCount(params.height, params.tickSpacingY, params.tickMinorSubdivision);
+			majorTicksY = ticksY / params.tickMinorSubdivision;
+		}
+		else
+		{
+			// Non-linear scales place their ticks at the powers of ten and their multiples
+			ticksY = ForEachScaleTick(params.scaleY, MAX_AXIS_TICKS, [&majorTicksY](double, bool major)
+			{
+				if (major)
+					++majorTicksY;
+			});
+		}
+
+		if (params.ticks)
+		{
+			layout.ticksX = ticksX;
+			layout.ticksY = ticksY;
+		}
+		if (params.grid)
+		{
+			layout.gridLinesX = ticksX / params.tickMinorSubdivision;
+			layout.gridLinesY = majorTicksY;
+		}
+		return layout;
+	}
+
+	/// \brief Return number of required spline segments for a spline with or without arrows, ticks and grid, tickLayout is the result of GetAxisTickLayout(params)
+	inline uint32_t GetNumberOfRequiredSplineSegments(const SplineDataAxisLayoutParameters &params, const SplineDataAxisTickLayout &tickLayout)
+	{
+		return (params.arrows ? 4 : 2) + tickLayout.GetSegmentCount();
+	}
+
+	/// \brief Return number of required spline points for a spline with or without arrows, ticks and grid, tickLayout is the result of GetAxisTickLayout(params)
+	inline uint32_t GetNumberOfRequiredSplinePoints(const SplineDataAxisLayoutParameters &params, const SplineDataAxisTickLayout &tickLayout)
+	{
+		return (params.arrows ? 10 : 4) + tickLayout.GetSegmentCount() * 2;
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Writes the points and segments of a coordinate system: two axes, optional arrows,
+	/// ticks and grid lines. All output is written in one pass.
+	/// @brief Writes the points and segments of a coordinate system.
+	/// @param[in] params							Parameter set for the layout
+	/// @param[in] tickLayout					Tick and grid line counts, the result of GetAxisTickLayout(params)
+	/// @param[out] points						Array of GetNumberOfRequiredSplinePoints() points, VECTOR must be constructible from (x, y, z)
+	/// @param[out] segments					Array of GetNumberOfRequiredSplineSegments() segments, SEGMENT must have members cnt and closed
+	//----------------------------------------------------------------------------------------
+	template <typename VECTOR, typename SEGMENT>
+	void WriteSplineDataAxisLayout(const SplineDataAxisLayoutParameters &params, const SplineDataAxisTickLayout &tickLayout, VECTOR *points, SEGMENT *segments)
+	{
+		const int32_t segmentCount = (int32_t)GetNumberOfRequiredSplineSegments(params, tickLayout);
+
+		// Some value caching
+		const double widthPlusArrowOvershoot = params.width + params.arrowOvershoot + params.arrowHeight * 0.25;
+		const double heightPlusArrowOvershoot = params.height + params.arrowOvershoot + params.arrowHeight * 0.25;
+		const double halfArrowHeight = params.arrowHeight * 0.5;
+		const double halfArrowWidth = params.arrowWidth * 0.5;
+
+		// X axis
+		points[0] = VECTOR(-params.overshoot, 0.0, 0.0);
+		points[1] = VECTOR(widthPlusArrowOvershoot, 0.0, 0.0);
+
+		// Y axis
+		points[2] = VECTOR(0.0, -params.overshoot, 0.0);
+		points[3] = VECTOR(0.0, heightPlusArrowOvershoot, 0.0);
+
+		if (params.arrows)
+		{
+			// X arrow
+			points[4] = VECTOR(widthPlusArrowOvershoot - halfArrowHeight, halfArrowWidth, 0.0);
+			points[5] = VECTOR(widthPlusArrowOvershoot + halfArrowHeight, 0.0, 0.0);
+			points[6] = VECTOR(widthPlusArrowOvershoot - halfArrowHeight, -halfArrowWidth, 0.0);
+
+			// Y arrow
+			points[7] = VECTOR(-halfArrowWidth, heightPlusArrowOvershoot - halfArrowHeight, 0.0);
+			points[8] = VECTOR(0.0, heightPlusArrowOvershoot + halfArrowHeight, 0.0);
+			points[9] = VECTOR(halfArrowWidth, heightPlusArrowOvershoot - halfArrowHeight, 0.0);
+		}
+
+		// Set the closure status and the number of CVs for the axes
+		segments[0].closed = false;
+		segments[0].cnt = 2;
+
+		segments[1].closed = false;
+		segments[1].cnt = 2;
+
+		// If arrows are desired, set their segment data, too
+		if (params.arrows)
+		{
+			segments[2].closed = false;
+			segments[2].cnt = 3;
+
+			segments[3].closed = false;
+			segments[3].cnt = 3;
+		}
+
+		// Ticks and grid lines follow in one pass, each of them being a segment with two points
+		int32_t pointIndex = params.arrows ? 10 : 4;
+		int32_t segmentIndex = params.arrows ? 4 : 2;
+		const int32_t minorSubdivision = std::max(params.tickMinorSubdivision, (int32_t)1);
+		const double minorSpacingX = params.tickSpacingX / (double)minorSubdivision;
+		const double minorSpacingY = params.tickSpacingY / (double)minorSubdivision;
+
+		// X axis ticks, pointing downwards
+		for (int32_t tickIndex = 1; tickIndex <= tickLayout.ticksX; ++tickIndex)
+		{
+			const double x = (double)tickIndex * minorSpacingX;
+			const double tickLength = (tickIndex % minorSubdivision == 0) ? params.tickMajorLength : params.tickMinorLength;
+			points[pointIndex++] = VECTOR(x, 0.0, 0.0);
+			points[pointIndex++] = VECTOR(x, -tickLength, 0.0);
+		}
+
+		// Y axis ticks, pointing to the left
+		const bool linearY = params.scaleY.GetType() == SCALETYPE::LINEAR;
+		if (linearY)
+		{
+			for (int32_t tickIndex = 1; tickIndex <= tickLayout.ticksY; ++tickIndex)
+			{
+				const double y = (double)tickIndex * minorSpacingY;
+				const double tickLength = (tickIndex % minorSubdivision == 0) ? params.tickMajorLength : params.tickMinorLength;
+				points[pointIndex++] = VECTOR(0.0, y, 0.0);
+				points[pointIndex++] = VECTOR(-tickLength, y, 0.0);
+			}
+		}
+		else if (tickLayout.ticksY > 0)
+		{
+			ForEachScaleTick(params.scaleY, tickLayout.ticksY, [&params, points, &pointIndex](double y, bool major)
+			{
+				const double tickLength = major ? params.tickMajorLength : params.tickMinorLength;
+				points[pointIndex++] = VECTOR(0.0, y, 0.0);
+				points[pointIndex++] = VECTOR(-tickLength, y, 0.0);
+			});
+		}
+
+		// Vertical grid lines at the major ticks of the x axis
+		for (int32_t lineIndex = 1; lineIndex <= tickLayout.gridLinesX; ++lineIndex)
+		{
+			const double x = (double)lineIndex * params.tickSpacingX;
+			points[pointIndex++] = VECTOR(x, 0.0, 0.0);
+			points[pointIndex++] = VECTOR(x, params.height, 0.0);
+		}
+
+		// Horizontal grid lines at the major ticks of the y axis
+		if (linearY)
+		{
+			for (int32_t lineIndex = 1; lineIndex <= tickLayout.gridLinesY; ++lineIndex)
+			{
+				const double y = (double)lineIndex * params.tickSpacingY;
+				points[pointIndex++] = VECTOR(0.0, y, 0.0);
+				points[pointIndex++] = VECTOR(params.width, y, 0.0);
+			}
+		}
+		else if (tickLayout.gridLinesY > 0)
+		{
+			ForEachScaleTick(params.scaleY, MAX_AXIS_TICKS, [&params, points, &pointIndex](double y, bool major)
+			{
+				if (!major)
+					return;
+				points[pointIndex++] = VECTOR(0.0, y, 0.0);
+				points[pointIndex++] = VECTOR(params.width, y, 0.0);
+			});
+		}
+
+		for (; segmentIndex < segmentCount; ++segmentIndex)
+		{
+			segments[segmentIndex].closed = false;
+			segments[segmentIndex].cnt = 2;
+		}
+	}
+}
+
+#endif // CORE_AXISLAYOUT_H__
@@ -0,0 +1,202 @@
+#ifndef CORE_CURVELAYOUT_H__
+#define CORE_CURVELAYOUT_H__
+
+// This header does not depend on the Cinema 4D API, it is shared with the command line renderer.
+#include <cstdint>
+
+#include "scalemapping.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// Optional overlay curves, written in the same pass as the curve itself.
+	//----------------------------------------------------------------------------------------
+	template <typename VECTOR>
+	struct SplineDataCurveOverlays
+	{
+		VECTOR *derivativePoints;   ///< Receives the points of the derivative, or nullptr
+		VECTOR *integralPoints;     ///< Receives the points of the running integral, or nullptr
+		double sampleSpacing;       ///< Distance between two samples along the curve, the whole curve spans 0.0 - 1.0
+		double derivativeHeight;    ///< Output height of a derivative of 1.0
+		double integralHeight;      ///< Output height of an integral of 1.0
+
+		/// \brief Default constructor
+		SplineDataCurveOverlays() : derivativePoints(nullptr), integralPoints(nullptr), sampleSpacing(0.0), derivativeHeight(0.0), integralHeight(0.0)
+		{
+		}
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Writes the tangents of a Bezier spline through evenly spaced curve points, so that it
+	/// follows the curve's derivative at each point (cubic Hermite interpolation). The spline's
+	/// slope then doesn't depend on the number of points.
+	/// @brief Writes Bezier tangents that follow the curve's derivative.
+	/// @param[out] tangents					Array receiving count tangents, TANGENT must have VECTOR members vl and vr
+	/// @param[in] derivatives				Derivative of each point's mapped value with respect to the point index
+	/// @param[in] count							Number of points
+	/// @param[in] xStep							Distance between two points along the x axis
+	//----------------------------------------------------------------------------------------
+	template <typename TANGENT, typename VECTOR = decltype(TANGENT::vl)>
+	void WriteSplineDataCurveTangents(TANGENT *tangents, const double *derivatives, int64_t count, double xStep)
+	{
+		const double handleX = xStep / 3.0;
+		for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+		{
+			const double handleY = derivatives[pointIndex] / 3.0;
+			tangents[pointIndex].vl = VECTOR(-handleX, -handleY, 0.0);
+			tangents[pointIndex].vr = VECTOR(handleX, handleY, 0.0);
+		}
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Writes the tangents of a Bezier spline through points, so that it interpolates them
+	/// like a Catmull-Rom spline. Used for curves without a known derivative, e.g. the overlays.
+	/// @brief Writes Catmull-Rom tangents for a Bezier spline.
+	/// @param[out] tangents					Array receiving count tangents, TANGENT must have VECTOR members vl and vr
+	/// @param[in] points							The points, VECTOR must be constructible from (x, y, z)
+	/// @param[in] count							Number of points
+	//----------------------------------------------------------------------------------------
+	template <typename TANGENT, typename VECTOR>
+	void WriteSplineDataCatmullRomTangents(TANGENT *tangents, const VECTOR *points, int64_t count)
+	{
+		for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+		{
+			// Central difference in the interior, one-sided at the ends
+			const int64_t prev = pointIndex > 0 ? pointIndex - 1 : pointIndex;
+			const int64_t next = pointIndex + 1 < count ? pointIndex + 1 : pointIndex;
+			const double factor = next - prev > 1 ? 1.0 / 6.0 : 1.0 / 3.0;
+			const double handleX = (points[next].x - points[prev].x) * factor;
+			const double handleY = (points[next].y - points[prev].y) * factor;
+			tangents[pointIndex].vl = VECTOR(-handleX, -handleY, 0.0);
+			tangents[pointIndex].vr = VECTOR(handleX, handleY, 0.0);
+		}
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Writes curve points from pre-sampled values, optionally blended between two sample
+	/// buffers, and mapped to the chart height with TRANSFORM. In the same loop, it writes the
+	/// derivative (finite differences, central where possible) and the running integral
+	/// (trapezoid rule) of the values. No additional samples are evaluated.
+	/// The overlays are mapped linearly, as they are usually not in the value range of the curve.
+	/// The first and last points are written separately, and the scale transform is resolved
+	/// at compile time, so the loop over the interior points only checks settings that don't
+	/// change during the loop.
+	/// Use WriteSplineDataCurvePoints() to choose the scale transform at run time.
+	/// @brief Writes curve points and their derivative and integral overlays, for a known scale transform.
+	/// @param[out] points						Array receiving count points, VECTOR must be constructible from (x, y, z)
+	/// @param[out] overlays					Overlay settings and arrays receiving count points each, only the overlays that are not nullptr are written
+	/// @param[in] valuesA						Sample values, VALUE may be float or double
+	/// @param[in] valuesB						Sample values to blend to, or nullptr to use valuesA unblended
+	/// @param[in] blend							Blend factor (0.0 - 1.0)
+	/// @param[in] count							Number of points to write
+	/// @param[in] xOffset						X position of the first point, e.g. to write a curve without overlays in chunks
+	/// @param[in] xStep							Distance between two samples along the x axis
+	/// @param[in] scale							Mapping from values to the chart height
+	//----------------------------------------------------------------------------------------
+	template <typename TRANSFORM, typename VECTOR, typename VALUE>
+	void WriteSplineDataCurvePoints(VECTOR *points, const SplineDataCurveOverlays<VECTOR> &overlays, const VALUE *valuesA, const VALUE *valuesB, double blend, int64_t count, double xOffset, double xStep, const ScaleMapping &scale)
+	{
+		if (count <= 0)
+			return;
+
+		VECTOR *derivativePoints = overlays.derivativePoints;
+		VECTOR *integralPoints = overlays.integralPoints;
+		const auto getValue = [valuesA, valuesB, blend](int64_t index) -> double
+		{
+			if (!valuesB)
+				return (double)valuesA[index];
+			return (double)valuesA[index] + ((double)valuesB[index] - (double)valuesA[index]) * blend;
+		};
+
+		const double inverseSpacing = overlays.sampleSpacing > 0.0 ? 1.0 / overlays.sampleSpacing : 0.0;
+		const double halfSpacing = overlays.sampleSpacing * 0.5;
+		const double derivativeScale = inverseSpacing * overlays.derivativeHeight;
+		const double centralDerivativeScale = derivativeScale * 0.5;
+
+		// A single point has no slope and no area
+		double previousValue = getValue(0);
+		if (count == 1)
+		{
+			points[0] = VECTOR(xOffset, scale.MapWith<TRANSFORM>(previousValue), 0.0);
+			if (derivativePoints)
+				derivativePoints[0] = VECTOR(xOffset, 0.0, 0.0);
+			if (integralPoints)
+				integralPoints[0] = VECTOR(xOffset, 0.0, 0.0);
+			return;
+		}
+
+		// First point, one-sided difference
+		double value = getValue(1);
+		points[0] = VECTOR(xOffset, scale.MapWith<TRANSFORM>(previousValue), 0.0);
+		if (derivativePoints)
+			derivativePoints[0] = VECTOR(xOffset, (value - previousValue) * derivativeScale, 0.0);
+		if (integralPoints)
+			integralPoints[0] = VECTOR(xOffset, 0.0, 0.0);
+
+		// Interior points, central difference
+		double integral = 0.0;
+		const int64_t lastIndex = count - 1;
+		for (int64_t pointIndex = 1; pointIndex < lastIndex; ++pointIndex)
+		{
+			const double nextValue = getValue(pointIndex + 1);
+			const double x = xOffset + (double)pointIndex * xStep;
+			points[pointIndex] = VECTOR(x, scale.MapWith<TRANSFORM>(value), 0.0);
+			if (derivativePoints)
+				derivativePoints[pointIndex] = VECTOR(x, (nextValue - previousValue) * centralDerivativeScale, 0.0);
+			if (integralPoints)
+			{
+				integral += (previousValue + value) * halfSpacing;
+				integralPoints[pointIndex] = VECTOR(x, integral * overlays.integralHeight, 0.0);
+			}
+			previousValue = value;
+			value = nextValue;
+		}
+
+		// Last point, one-sided difference
+		const double x = xOffset + (double)lastIndex * xStep;
+		points[lastIndex] = VECTOR(x, scale.MapWith<TRANSFORM>(value), 0.0);
+		if (derivativePoints)
+			derivativePoints[lastIndex] = VECTOR(x, (value - previousValue) * derivativeScale, 0.0);
+		if (integralPoints)
+		{
+			integral += (previousValue + value) * halfSpacing;
+			integralPoints[lastIndex] = VECTOR(x, integral * overlays.integralHeight, 0.0);
+		}
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Writes curve points and their derivative and integral overlays, see
+	/// WriteSplineDataCurvePoints<TRANSFORM>(). The scale transform is chosen once per call,
+	/// not per point.
+	/// @brief Writes curve points and their derivative and integral overlays.
+	/// @param[out] points						Array receiving count points, VECTOR must be constructible from (x, y, z)
+	/// @param[out] overlays					Overlay settings and arrays receiving count points each, only the overlays that are not nullptr are written
+	/// @param[in] valuesA						Sample values, VALUE may be float or double
+	/// @param[in] valuesB						Sample values to blend to, or nullptr to use valuesA unblended
+	/// @param[in] blend							Blend factor (0.0 - 1.0)
+	/// @param[in] count							Number of points to write
+	/// @param[in] xOffset						X position of the first point, e.g. to write a curve without overlays in chunks
+	/// @param[in] xStep							Distance between two samples along the x axis
+	/// @param[in] scale							Mapping from values to the chart height
+	//----------------------------------------------------------------------------------------
+	template <typename VECTOR, typename VALUE>
+	void WriteSplineDataCurvePoints(VECTOR *points, const SplineDataCurveOverlays<VECTOR> &overlays, const VALUE *valuesA, const VALUE *valuesB, double blend, int64_t count, double xOffset, double xStep, const ScaleMapping &scale)
+	{
+		switch (scale.GetType())
+		{
+			case SCALETYPE::LOG10:
+				WriteSplineDataCurvePoints<ScaleTransformLog10>(points, overlays, valuesA, valuesB, blend, count, xOffset, xStep, scale);
+				break;
+			case SCALETYPE::SYMLOG:
+				WriteSplineDataCurvePoints<ScaleTransformSymLog>(points, overlays, valuesA, valuesB, blend, count, xOffset, xStep, scale);
+				break;
+			case SCALETYPE::LINEAR:
+			default:
+				WriteSplineDataCurvePoints<ScaleTransformLinear>(points, overlays, valuesA, valuesB, blend, count, xOffset, xStep, scale);
+				break;
+		}
+	}
+}
+
+#endif // CORE_CURVELAYOUT_H__
@@ -0,0 +1,82 @@
+#ifndef CORE_POLARLAYOUT_H__
+#define CORE_POLARLAYOUT_H__
+
+// This header does not depend on the Cinema 4D API.
+#include <cmath>
+#include <cstdint>
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// Fills tables with the cosine and sine of evenly spaced angles. The first sample is at
+	/// startAngle, the last one at startAngle + sweepAngle.
+	/// @brief Fills tables with the cosine and sine of evenly spaced angles.
+	/// @param[out] cosValues					Array receiving count cosine values
+	/// @param[out] sinValues					Array receiving count sine values
+	/// @param[in] count							Number of angles
+	/// @param[in] startAngle					Angle of the first sample in radians
+	/// @param[in] sweepAngle					Angle between the first and the last sample in radians, negative values go clockwise
+	//----------------------------------------------------------------------------------------
+	inline void FillPolarAngleTable(double *cosValues, double *sinValues, int64_t count, double startAngle, double sweepAngle)
+	{
+		const double angleStep = count > 1 ? sweepAngle / (double)(count - 1) : 0.0;
+		for (int64_t sampleIndex = 0; sampleIndex < count; ++sampleIndex)
+		{
+			const double angle = startAngle + (double)sampleIndex * angleStep;
+			cosValues[sampleIndex] = std::cos(angle);
+			sinValues[sampleIndex] = std::sin(angle);
+		}
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Turns curve points into a polar layout: the y value of each point becomes its radius,
+	/// its index selects the angle from the tables.
+	/// @brief Turns curve points into a polar layout.
+	/// @param[in,out] points					Curve points, VECTOR must be constructible from (x, y, z)
+	/// @param[in] count							Number of points, must not exceed the size of the tables
+	/// @param[in] cosValues					Cosine of the angle of each point
+	/// @param[in] sinValues					Sine of the angle of each point
+	//----------------------------------------------------------------------------------------
+	template <typename VECTOR>
+	void ApplySplineDataPolarLayout(VECTOR *points, int64_t count, const double *cosValues, const double *sinValues)
+	{
+		for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+		{
+			const double radius = points[pointIndex].y;
+			points[pointIndex] = VECTOR(cosValues[pointIndex] * radius, sinValues[pointIndex] * radius, 0.0);
+		}
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Turns curve points and their Bezier tangents into a polar layout. The tangents must have
+	/// been written by WriteSplineDataCurveTangents(): their y component is the change of the
+	/// radius, and the change of the angle adds a circular component.
+	/// @brief Turns curve points and their Bezier tangents into a polar layout.
+	/// @param[in,out] points					Curve points, VECTOR must be constructible from (x, y, z)
+	/// @param[in,out] tangents				Tangents of the points, TANGENT must have VECTOR members vl and vr
+	/// @param[in] count							Number of points, must not exceed the size of the tables
+	/// @param[in] cosValues					Cosine of the angle of each point
+	/// @param[in] sinValues					Sine of the angle of each point
+	/// @param[in] angleStep					Angle between two points in radians
+	//----------------------------------------------------------------------------------------
+	template <typename VECTOR, typename TANGENT>
+	void ApplySplineDataPolarLayout(VECTOR *points, TANGENT *tangents, int64_t count, const double *cosValues, const double *sinValues, double angleStep)
+	{
+		for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+		{
+			const double radius = points[pointIndex].y;
+			const double radialHandle = tangents[pointIndex].vr.y;
+			const double angularHandle = radius * angleStep / 3.0;
+			const double cosValue = cosValues[pointIndex];
+			const double sinValue = sinValues[pointIndex];
+			const double handleX = cosValue * radialHandle - sinValue * angularHandle;
+			const double handleY = sinValue * radialHandle + cosValue * angularHandle;
+			tangents[pointIndex].vl = VECTOR(-handleX, -handleY, 0.0);
+			tangents[pointIndex].vr = VECTOR(handleX, handleY, 0.0);
+			points[pointIndex] = VECTOR(cosValue * radius, sinValue * radius, 0.0);
+		}
+	}
+}
+
+#endif // CORE_POLARLAYOUT_H__
@@ -0,0 +1,239 @@
+#ifndef CORE_SCALEMAPPING_H__
+#define CORE_SCALEMAPPING_H__
+
+// This header does not depend on the Cinema 4D API, it is shared with the command line renderer.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+
+namespace SplineDataVisualizationHelpers
+{
+	// Scale constants
+	const double DEFAULT_SCALE_SYMLOG_THRESHOLD = 1.0;
+	const double SCALE_LOG_MIN_VALUE = 1.0e-6;
+
+	/// \brief Scale types, values match the description cycles of the generators
+	enum class SCALETYPE
+	{
+		LINEAR = 0,
+		LOG10 = 1,
+		SYMLOG = 2
+	};
+
+	/// \brief Linear scale transform. All transforms take the symmetric logarithmic threshold, so they can be swapped in kernels.
+	/// Derivative() returns the derivative of Transform() at value.
+	struct ScaleTransformLinear
+	{
+		static double Transform(double value, double /*linearThreshold*/)
+		{
+			return value;
+		}
+
+		static double Derivative(double /*value*/, double /*linearThreshold*/)
+		{
+			return 1.0;
+		}
+	};
+
+	/// \brief Logarithmic scale transform, values are clamped to a small positive minimum
+	struct ScaleTransformLog10
+	{
+		static double Transform(double value, double /*linearThreshold*/)
+		{
+			return std::log10(std::max(value, SCALE_LOG_MIN_VALUE));
+		}
+
+		static double Derivative(double value, double /*linearThreshold*/)
+		{
+			return value > SCALE_LOG_MIN_VALUE ? 1.0 / (value * std::log(10.0)) : 0.0;
+		}
+	};
+
+	/// \brief Symmetric logarithmic scale transform, linear around zero and logarithmic beyond the threshold
+	struct ScaleTransformSymLog
+	{
+		static double Transform(double value, double linearThreshold)
+		{
+			return std::copysign(std::log10(1.0 + std::abs(value) / linearThreshold), value);
+		}
+
+		static double Derivative(double value, double linearThreshold)
+		{
+			return 1.0 / ((linearThreshold + std::abs(value)) * std::log(10.0));
+		}
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Maps data values from a value range to output coordinates, using a linear,
+	/// logarithmic or symmetric logarithmic scale. The mapping is a closed-form
+	/// transform; offset and factor are precomputed once, so mapping a value is a
+	/// single transform, a subtraction and a multiplication.
+	/// Shared by the axis tick layout and the curve sampler.
+	//----------------------------------------------------------------------------------------
+	class ScaleMapping
+	{
+	public:
+		/// \brief Default constructor, maps 0.0 - 1.0 linearly to 0.0 - 1.0
+		ScaleMapping() : _type(SCALETYPE::LINEAR), _minValue(0.0), _maxValue(1.0), _offset(0.0), _factor(1.0), _linearThreshold(DEFAULT_SCALE_SYMLOG_THRESHOLD)
+		{
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Constructs a mapping. Invalid ranges are sanitized, so the mapping is always usable.
+		/// @brief Constructs a mapping.
+		/// @param[in] type								Scale type
+		/// @param[in] minValue						Data value mapped to 0.0
+		/// @param[in] maxValue						Data value mapped to outputLength
+		/// @param[in] outputLength				Length of the output range (e.g. the height of the chart)
+		//----------------------------------------------------------------------------------------
+		ScaleMapping(SCALETYPE type, double minValue, double maxValue, double outputLength) : _type(type), _minValue(minValue), _maxValue(maxValue), _offset(0.0), _factor(0.0), _linearThreshold(DEFAULT_SCALE_SYMLOG_THRESHOLD)
+		{
+			if (_type == SCALETYPE::LOG10)
+			{
+				_minValue = std::max(_minValue, SCALE_LOG_MIN_VALUE);
+				_maxValue = std::max(_maxValue, _minValue * 10.0);
+			}
+
+			_offset = Transform(_minValue);
+			const double range = Transform(_maxValue) - _offset;
+			if (range > 0.0)
+				_factor = outputLength / range;
+		}
+
+		/// \brief Returns the scale type
+		SCALETYPE GetType() const
+		{
+			return _type;
+		}
+
+		/// \brief Returns the (sanitized) data value mapped to 0.0
+		double GetMinValue() const
+		{
+			return _minValue;
+		}
+
+		/// \brief Returns the (sanitized) data value mapped to the output length
+		double GetMaxValue() const
+		{
+			return _maxValue;
+		}
+
+		/// \brief Returns the threshold below which the symmetric logarithmic scale is linear
+		double GetLinearThreshold() const
+		{
+			return _linearThreshold;
+		}
+
+		/// \brief Maps a single value, for use in inner loops that have been specialized for a transform
+		template <typename TRANSFORM>
+		double MapWith(double value) const
+		{
+			return (TRANSFORM::Transform(value, _linearThreshold) - _offset) * _factor;
+		}
+
+		/// \brief Maps a single value
+		double Map(double value) const
+		{
+			return (Transform(value) - _offset) * _factor;
+		}
+
+		/// \brief Returns the derivative of Map() at value, to map slopes of the data with the chain rule
+		double MapDerivative(double value) const
+		{
+			switch (_type)
+			{
+				case SCALETYPE::LOG10:
+					return ScaleTransformLog10::Derivative(value, _linearThreshold) * _factor;
+				case SCALETYPE::SYMLOG:
+					return ScaleTransformSymLog::Derivative(value, _linearThreshold) * _factor;
+				case SCALETYPE::LINEAR:
+				default:
+					return ScaleTransformLinear::Derivative(value, _linearThreshold) * _factor;
+			}
+		}
+
+	private:
+		/// \brief Applies the transform of the scale type
+		double Transform(double value) const
+		{
+			switch (_type)
+			{
+				case SCALETYPE::LOG10:
+					return ScaleTransformLog10::Transform(value, _linearThreshold);
+				case SCALETYPE::SYMLOG:
+					return ScaleTransformSymLog::Transform(value, _linearThreshold);
+				case SCALETYPE::LINEAR:
+				default:
+					return ScaleTransformLinear::Transform(value, _linearThreshold);
+			}
+		}
+
+		SCALETYPE _type;
+		double _minValue;
+		double _maxValue;
+		double _offset;
+		double _factor;
+		double _linearThreshold;
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Calls tickFunc for each tick of a logarithmic or symmetric logarithmic scale inside
+	/// the mapping's value range: major ticks at the powers of ten (and at zero for symlog),
+	/// minor ticks at their multiples 2 - 9. Does nothing for linear scales.
+	/// @brief Calls tickFunc for each tick of a non-linear scale.
+	/// @param[in] mapping						The scale mapping
+	/// @param[in] maxTicks						Maximum number of ticks
+	/// @param[in] tickFunc						Callable with signature void(double position, bool major), position is the mapped value
+	/// @return												Number of ticks
+	//----------------------------------------------------------------------------------------
+	template <typename FUNC>
+	int32_t ForEachScaleTick(const ScaleMapping &mapping, int32_t maxTicks, FUNC &&tickFunc)
+	{
+		if (mapping.GetType() == SCALETYPE::LINEAR)
+			return 0;
+
+		const double minValue = mapping.GetMinValue();
+		const double maxValue = mapping.GetMaxValue();
+		int32_t tickCount = 0;
+
+		// Add ticks at sign * m * 10^decade for all decades in [firstDecade, lastDecade]
+		auto addDecades = [&](double sign, int32_t firstDecade, int32_t lastDecade)
+		{
+			for (int32_t decade = firstDecade; decade <= lastDecade && tickCount < maxTicks; ++decade)
+			{
+				const double decadeValue = std::pow(10.0, (double)decade);
+				for (int32_t multiple = 1; multiple <= 9 && tickCount < maxTicks; ++multiple)
+				{
+					const double value = sign * (double)multiple * decadeValue;
+					if (value < minValue || value > maxValue)
+						continue;
+					tickFunc(mapping.Map(value), multiple == 1);
+					++tickCount;
+				}
+			}
+		};
+
+		if (mapping.GetType() == SCALETYPE::LOG10)
+		{
+			addDecades(1.0, (int32_t)std::floor(std::log10(minValue)), (int32_t)std::ceil(std::log10(maxValue)));
+			return tickCount;
+		}
+
+		// Symmetric logarithmic scale: zero, and the decades beyond the linear threshold on both sides
+		const int32_t firstDecade = (int32_t)std::floor(std::log10(mapping.GetLinearThreshold()));
+		if (minValue <= 0.0 && maxValue >= 0.0 && tickCount < maxTicks)
+		{
+			tickFunc(mapping.Map(0.0), true);
+			++tickCount;
+		}
+		if (maxValue > 0.0)
+			addDecades(1.0, firstDecade, (int32_t)std::ceil(std::log10(std::max(maxValue, mapping.GetLinearThreshold()))));
+		if (minValue < 0.0)
+			addDecades(-1.0, firstDecade, (int32_t)std::ceil(std::log10(std::max(-minValue, mapping.GetLinearThreshold()))));
+
+		return tickCount;
+	}
+}
+
+#endif // CORE_SCALEMAPPING_H__
@@ -9,14 +9,25 @@ Bool PluginStart()
 		return false;
 	if (!RegisterSplineDataAxisSpline())
 		return false;
+	if (!RegisterSplineDataMultiSpline())
+		return false;
+	if (!RegisterSplineDataArea())
+		return false;
+	if (!RegisterSplineDataLabel())
+		return false;
+	if (!RegisterSplineDataChart())
+		return false;
 	if (!RegisterFaceCameraTag())
 		return false;
+	if (!RegisterRegenerationScheduler())
+		return false;
 
 	return true;
 }
 
 void PluginEnd()
 {
+	FreeSplineDataLabelGlyphCache();
 }
 
 Bool PluginMessage(Int32 id, void* data)
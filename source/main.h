@@ -5,7 +5,14 @@
 
 Bool RegisterSplineDataSpline();
 Bool RegisterSplineDataAxisSpline();
+Bool RegisterSplineDataMultiSpline();
+Bool RegisterSplineDataArea();
+Bool RegisterSplineDataLabel();
+Bool RegisterSplineDataChart();
 Bool RegisterSplineDataVisCommand();
 Bool RegisterFaceCameraTag();
+Bool RegisterRegenerationScheduler();
+
+void FreeSplineDataLabelGlyphCache();
 
 #endif // MAIN_H__
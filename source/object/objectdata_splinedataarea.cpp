@@ -0,0 +1,207 @@
+// Includes from API
+#include "c4d_baseobject.h"
+#include "c4d_includes.h"
+#include "c4d_objectdata.h"
+
+// Includes from plugin project
+#include "c4d_symbols.h"
+#include "main.h"
+
+// Local resources
+#include "osplinedataarea.h"
+#include "c4d_resource.h"
+
+// Common values
+#include "commons.h"
+#include "sampling.h"
+#include "core/arealayout.h"
+#include "core/curvelayout.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// Global function responsible to create the polygons of the area below a curve.
+	/// @brief Global function responsible to create the polygons of the area below a curve.
+	/// @param[out] polyObj						PolygonObject that will receive the resulting points and polygons, allocated with the required counts
+	/// @param[in] curvePoints				The curve's points
+	/// @param[in] count							Number of curve points
+	/// @param[in] baselineY					Height of the baseline
+	/// @return												True if creation process succeeds
+	//----------------------------------------------------------------------------------------
+	static maxon::Result<void> CreateSplineDataArea(PolygonObject& polyObj, const Vector *curvePoints, Int32 count, Float baselineY)
+	{
+		if (!curvePoints || count < 2)
+			return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+
+		const Int crossingCount = CountBaselineCrossings(curvePoints, count, baselineY);
+		if (polyObj.GetPointCount() != GetNumberOfRequiredAreaPoints(count, crossingCount) || polyObj.GetPolygonCount() != GetNumberOfRequiredAreaPolygons(count, crossingCount))
+			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
+
+		// Access the writable arrays of points and polygons
+		Vector* polyPntsPtr = polyObj.GetPointW();
+		if (nullptr == polyPntsPtr)
+			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
+
+		CPolygon* polyPolysPtr = polyObj.GetPolygonW();
+		if (nullptr == polyPolysPtr)
+			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
+
+		// The curve is a function of x, so the area is a simple strip
+		WriteSplineDataAreaMesh(curvePoints, count, baselineY, polyPntsPtr, polyPolysPtr);
+
+		return maxon::OK;
+	}
+}
+
+
+//------------------------------------------------------------------------------------------------
+/// ObjectData implementation generating a polygon mesh filling the area below a SplineData curve
+//------------------------------------------------------------------------------------------------
+class SplineDataAreaObject : public ObjectData
+{
+	INSTANCEOF(SplineDataAreaObject, ObjectData)
+
+public:
+	virtual Bool Init(GeListNode* node);
+	virtual void GetDimension(BaseObject* op, Vector* mp, Vector* rad);
+	virtual BaseObject* GetVirtualObjects(BaseObject* op, HierarchyHelp* hh);
+
+	static NodeData* Alloc()
+	{
+		return NewObj(SplineDataAreaObject) iferr_ignore("SplineDataAreaObject plugin not instanced");
+	}
+
+private:
+	SplineDataVisualizationHelpers::SplineDataSampleCache _sampleCache; ///< Samples of the SplineData curve
+	maxon::BaseArray<Vector> _curvePoints;                              ///< Points of the curve, reused between calls
+};
+
+Bool SplineDataAreaObject::Init(GeListNode* node)
+{
+	if (!node)
+		return false;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseObject*		 baseObjectPtr = static_cast<BaseObject*>(node);
+	BaseContainer* objectDataPtr = baseObjectPtr->GetDataInstance();
+
+	// Fill object container with initial values
+	objectDataPtr->SetFloat(OSPLINEDATAAREA_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
+	objectDataPtr->SetFloat(OSPLINEDATAAREA_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
+	objectDataPtr->SetUInt32(OSPLINEDATAAREA_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION);
+	objectDataPtr->SetFloat(OSPLINEDATAAREA_BASELINE, SplineDataVisualizationHelpers::DEFAULT_AREA_BASELINE);
+	objectDataPtr->SetInt32(OSPLINEDATAAREA_SCALE, OSPLINEDATAAREA_SCALE_LINEAR);
+	objectDataPtr->SetFloat(OSPLINEDATAAREA_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	objectDataPtr->SetFloat(OSPLINEDATAAREA_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
+
+	GeData geSplineData(CUSTOMDATATYPE_SPLINE, DEFAULTVALUE);
+	SplineData *splineData = (SplineData*)geSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
+	splineData->MakeLinearSplineBezier(2);
+	objectDataPtr->SetData(OSPLINEDATAAREA_SPLINECURVE, geSplineData);
+
+	return true;
+}
+
+void SplineDataAreaObject::GetDimension(BaseObject *op, Vector *mp, Vector *rad)
+{
+	// Check the passed pointers.
+	if (!op || ! mp || !rad)
+		return;
+
+	// Reset the barycenter position and the bbox radius vector.
+	mp->SetZero();
+	rad->SetZero();
+
+	// Set the barycenter position to match the generator center.
+	const Vector objGlobalOffset = op->GetMg().off;
+	mp->x = objGlobalOffset.x;
+	mp->y = objGlobalOffset.y;
+	mp->z = objGlobalOffset.z;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = op->GetDataInstance();
+	if (!objectDataPtr)
+		return;
+
+	// Set radius values accordingly to the bbox values stored during the init.
+	rad->x = objectDataPtr->GetFloat(OSPLINEDATAAREA_WIDTH);
+	rad->y = objectDataPtr->GetFloat(OSPLINEDATAAREA_HEIGHT);
+}
+
+BaseObject* SplineDataAreaObject::GetVirtualObjects(BaseObject *op, HierarchyHelp *hh)
+{
+	// Check the passed pointer.
+	if (!op)
+		return nullptr;
+
+	// Return the cache if nothing has changed
+	const Bool dirty = op->CheckCache(hh) || op->IsDirty(DIRTYFLAGS::DATA);
+	if (!dirty)
+		return op->GetCache(hh);
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = op->GetDataInstance();
+
+	// Fill the retrieve BaseContainer object with initial values.
+	const Float width = objectDataPtr->GetFloat(OSPLINEDATAAREA_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
+	const Float amplitude = objectDataPtr->GetFloat(OSPLINEDATAAREA_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
+	const UInt32 samples = objectDataPtr->GetUInt32(OSPLINEDATAAREA_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION) + 1;
+	const Float baseline = objectDataPtr->GetFloat(OSPLINEDATAAREA_BASELINE, SplineDataVisualizationHelpers::DEFAULT_AREA_BASELINE);
+	const SplineDataVisualizationHelpers::SCALETYPE scaleType = (SplineDataVisualizationHelpers::SCALETYPE)objectDataPtr->GetInt32(OSPLINEDATAAREA_SCALE, OSPLINEDATAAREA_SCALE_LINEAR);
+	const Float scaleMin = objectDataPtr->GetFloat(OSPLINEDATAAREA_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	const Float scaleMax = objectDataPtr->GetFloat(OSPLINEDATAAREA_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
+	const SplineDataVisualizationHelpers::ScaleMapping scale(scaleType, scaleMin, scaleMax, amplitude);
+	GeData geSplineData = objectDataPtr->GetData(OSPLINEDATAAREA_SPLINECURVE);
+	SplineData *splineData = (SplineData*)geSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
+	if (!splineData)
+		return nullptr;
+
+	// Sample the curve and write its points, the curve is only re-sampled if it has changed since the last call
+	iferr (_sampleCache.Update(splineData, samples))
+	{
+		DiagnosticOutput("Error on sampling SplineData: @", err);
+		return nullptr;
+	}
+	iferr (_curvePoints.Resize(samples))
+	{
+		DiagnosticOutput("Error on allocating curve points: @", err);
+		return nullptr;
+	}
+	const Float xStep = width / ((Float)samples - 1);
+	SplineDataVisualizationHelpers::WriteSplineDataCurvePoints(_curvePoints.GetFirst(), SplineDataVisualizationHelpers::SplineDataCurveOverlays<Vector>(), _sampleCache.GetValues(), (const Float32*)nullptr, 0.0, samples, 0.0, xStep, scale);
+
+	// The number of baseline crossings determines the exact point and polygon counts
+	const Float baselineY = scale.Map(baseline);
+	const Int crossingCount = SplineDataVisualizationHelpers::CountBaselineCrossings(_curvePoints.GetFirst(), (Int)samples, baselineY);
+	const Int32 pointCount = (Int32)SplineDataVisualizationHelpers::GetNumberOfRequiredAreaPoints(samples, crossingCount);
+	const Int32 polygonCount = (Int32)SplineDataVisualizationHelpers::GetNumberOfRequiredAreaPolygons(samples, crossingCount);
+
+	// Alloc a PolygonObject and check it.
+	PolygonObject* polyObjPtr = PolygonObject::Alloc(pointCount, polygonCount);
+	if (!polyObjPtr)
+		return nullptr;
+
+	// Invoke the helper function to set the PolygonObject object member accordingly
+	iferr (SplineDataVisualizationHelpers::CreateSplineDataArea(*polyObjPtr, _curvePoints.GetFirst(), (Int32)samples, baselineY))
+	{
+		DiagnosticOutput("Error on CreateSplineDataArea: @", err);
+		PolygonObject::Free(polyObjPtr);
+		return nullptr;
+	}
+
+	polyObjPtr->SetName(op->GetName());
+	polyObjPtr->Message(MSG_UPDATE);
+
+	return polyObjPtr;
+}
+
+
+Bool RegisterSplineDataArea()
+{
+	String registeredName = GeLoadString(IDS_OBJECTDATA_SPLINEDATAAREA);
+	if (!registeredName.IsPopulated())
+		return false;
+
+	return RegisterObjectPlugin(SplineDataVisualizationHelpers::ID_OBJECTDATA_SPLINEDATAAREA, registeredName, OBJECT_GENERATOR, SplineDataAreaObject::Alloc, "osplinedataarea"_s, AutoBitmap("osplinedataspline.tif"_s), 0);
+}
@@ -13,6 +13,8 @@
 
 // Common values
 #include "commons.h"
+#include "regenerationjob.h"
+#include "core/axislayout.h"
 
 
 namespace SplineDataVisualizationHelpers
@@ -20,16 +22,8 @@ namespace SplineDataVisualizationHelpers
 	//----------------------------------------------------------------------------------------
 	/// Struct to hold spline generation parameters
 	//----------------------------------------------------------------------------------------
-	struct SplineDataAxisSplineParameters
+	struct SplineDataAxisSplineParameters : public SplineDataAxisLayoutParameters
 	{
-		Float height;
-		Float width;
-		Float overshoot;
-		Bool arrows;
-		Float arrowHeight;
-		Float arrowWidth;
-		Float arrowOvershoot;
-
 		Bool closed;
 		SPLINETYPE splineType;
 		Int32 splineInterpolation;
@@ -38,8 +32,7 @@ namespace SplineDataVisualizationHelpers
 		Float splineSubMaxLength;
 
 		/// \brief Default constructor
-		SplineDataAxisSplineParameters() : height(0.0), width(0.0), overshoot(0.0), arrows(false),
-			arrowHeight(0.0), arrowWidth(0.0), arrowOvershoot(0.0),
+		SplineDataAxisSplineParameters() : SplineDataAxisLayoutParameters(),
 			closed(false), splineType(SPLINETYPE::LINEAR),
 			splineInterpolation(SPLINEOBJECT_INTERPOLATION_NONE),
 			splineSubdivision(0), splineSubAngle(0.0),
@@ -55,16 +48,22 @@ namespace SplineDataVisualizationHelpers
 																	 Float _arrowHeight,
 																	 Float _arrowWidth,
 																	 Float _arrowOvershoot,
+																	 Bool _ticks,
+																	 Float _tickSpacingX,
+																	 Float _tickSpacingY,
+																	 const ScaleMapping &_scaleY,
+																	 Int32 _tickMinorSubdivision,
+																	 Float _tickMajorLength,
+																	 Float _tickMinorLength,
+																	 Bool _grid,
 																	 Bool _closed,
 																	 SPLINETYPE _splineType,
 																	 Int32 _splineInterpolation,
 																	 Int32 _splineSubdivision,
 																	 Float _splineSubAngle,
 																	 Float _splineSubMaxLength) :
-			height(_height), width(_width),
-			overshoot(_overshoot), arrows(_arrows),
-			arrowHeight(_arrowHeight), arrowWidth(_arrowWidth),
-			arrowOvershoot(_arrowOvershoot),
+			SplineDataAxisLayoutParameters(_height, _width, _overshoot, _arrows, _arrowHeight, _arrowWidth, _arrowOvershoot,
+				_ticks, _tickSpacingX, _tickSpacingY, _scaleY, _tickMinorSubdivision, _tickMajorLength, _tickMinorLength, _grid),
 			closed(_closed), splineType(_splineType),
 			splineInterpolation(_splineInterpolation),
 			splineSubdivision(_splineSubdivision),
@@ -74,26 +73,15 @@ namespace SplineDataVisualizationHelpers
 		}
 	};
 
-	/// \brief Return number of required spline segments for a spline with or without arrows
-	inline UInt32 GetNumberOfRequiredSplineSegments(Bool arrows)
-	{
-		return arrows ? 4 : 2;
-	}
-
-	/// \brief Return number of required spline points for a spline with or without arrows
-	inline UInt32 GetNumberOfRequiredSplinePoints(Bool arrows)
-	{
-		return arrows ? 10 : 4;
-	}
-
 	//----------------------------------------------------------------------------------------
 	/// Global function responsible to create the spline points.
 	/// @brief Global function responsible to create the spline points.
 	/// @param[out] splineObj					SplineObject that will receive the resulting points
 	/// @param[in] params							Parameter set for spline generation
+	/// @param[in] tickLayout					Tick and grid line counts of params
 	/// @return												True if creation process succeeds
 	//----------------------------------------------------------------------------------------
-	static maxon::Result<void> CreateSplineDataAxisSpline(SplineObject& splineObj, SplineDataAxisSplineParameters &params)
+	static maxon::Result<void> CreateSplineDataAxisSpline(SplineObject& splineObj, SplineDataAxisSplineParameters &params, const SplineDataAxisTickLayout &tickLayout)
 	{
 		// Set the closed/open status of the SplineObject instance accessing its BaseContainer instance
 		BaseContainer* splineObjBCPtr = splineObj.GetDataInstance();
@@ -107,7 +95,9 @@ namespace SplineDataVisualizationHelpers
 		}
 
 		// Set the number of segments
-		const Int32 segmentCount = GetNumberOfRequiredSplineSegments(params.arrows);
+		const Int32 segmentCount = GetNumberOfRequiredSplineSegments(params, tickLayout);
+		if (splineObj.GetPointCount() != (Int32)GetNumberOfRequiredSplinePoints(params, tickLayout))
+			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
 		if (!splineObj.MakeVariableTag(Tsegment, segmentCount))
 			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
 
@@ -116,56 +106,13 @@ namespace SplineDataVisualizationHelpers
 		if (nullptr == splinePntsPtr)
 			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
 
-		// Set spline points
-
-		// Some value caching
-		const Float widthPlusArrowOvershoot = params.width + params.arrowOvershoot + params.arrowHeight * 0.25;
-		const Float heightPlusArrowOvershoot = params.height + params.arrowOvershoot + params.arrowHeight * 0.25;
-		const Float halfArrowHeight = params.arrowHeight * 0.5;
-		const Float halfArrowWidth = params.arrowWidth * 0.5;
-
-		// X axis
-		splinePntsPtr[0] = Vector(-params.overshoot, 0.0, 0.0);
-		splinePntsPtr[1] = Vector(widthPlusArrowOvershoot, 0.0, 0.0);
-
-		// Y axis
-		splinePntsPtr[2] = Vector(0.0, -params.overshoot, 0.0);
-		splinePntsPtr[3] = Vector(0.0, heightPlusArrowOvershoot, 0.0);
-
-		if (params.arrows)
-		{
-			// X arrow
-			splinePntsPtr[4] = Vector(widthPlusArrowOvershoot - halfArrowHeight, halfArrowWidth, 0.0);
-			splinePntsPtr[5] = Vector(widthPlusArrowOvershoot + halfArrowHeight, 0.0, 0.0);
-			splinePntsPtr[6] = Vector(widthPlusArrowOvershoot - halfArrowHeight, -halfArrowWidth, 0.0);
-
-			// Y arrow
-			splinePntsPtr[7] = Vector(-halfArrowWidth, heightPlusArrowOvershoot - halfArrowHeight, 0.0);
-			splinePntsPtr[8] = Vector(0.0, heightPlusArrowOvershoot + halfArrowHeight, 0.0);
-			splinePntsPtr[9] = Vector(halfArrowWidth, heightPlusArrowOvershoot - halfArrowHeight, 0.0);
-		}
-
 		// Access the curve's segments array.
 		Segment* splineSegsPtr = splineObj.GetSegmentW();
 		if (nullptr == splineSegsPtr)
 			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
 
-		// Set the closure status and the number of CVs for the only one segment existing.
-		splineSegsPtr[0].closed = false;
-		splineSegsPtr[0].cnt = 2;
-
-		splineSegsPtr[1].closed = false;
-		splineSegsPtr[1].cnt = 2;
-
-		// If arrows are desired, set their segment data, too
-		if (params.arrows)
-		{
-			splineSegsPtr[2].closed = false;
-			splineSegsPtr[2].cnt = 3;
-
-			splineSegsPtr[3].closed = false;
-			splineSegsPtr[3].cnt = 3;
-		}
+		// Set axes, arrows, ticks and grid lines
+		WriteSplineDataAxisLayout(params, tickLayout, splinePntsPtr, splineSegsPtr);
 
 		return maxon::OK;
 	}
@@ -175,7 +122,7 @@ namespace SplineDataVisualizationHelpers
 //------------------------------------------------------------------------------------------------
 /// ObjectData implementation generating a pair of coordinate system axes
 //------------------------------------------------------------------------------------------------
-class SplineDataAxisSplineObject : public ObjectData
+class SplineDataAxisSplineObject : public ObjectData, public SplineDataVisualizationHelpers::SplineDataRegenerationJob
 {
 	INSTANCEOF(SplineDataAxisSplineObject, ObjectData)
 
@@ -183,6 +130,8 @@ public:
 	virtual Bool Init(GeListNode* node);
 	virtual void GetDimension(BaseObject* op, Vector* mp, Vector* rad);
 	virtual SplineObject* GetContour(BaseObject* op, BaseDocument* doc, Float lod, BaseThread* bt);
+	virtual SplineObject* BuildContour(BaseObject& op, BaseThread* bt);
+	virtual Bool Message(GeListNode* node, Int32 type, void* data);
 	Bool GetDEnabling(GeListNode *node, const DescID &id, const GeData &t_data, DESCFLAGS_ENABLE flags, const BaseContainer *itemdesc);
 
 	static NodeData* Alloc()
@@ -208,6 +157,16 @@ Bool SplineDataAxisSplineObject::Init(GeListNode* node)
 	objectDataPtr->SetFloat(OSPLINEDATAAXIS_ARROW_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_HEIGHT);
 	objectDataPtr->SetFloat(OSPLINEDATAAXIS_ARROW_WIDTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_WIDTH);
 	objectDataPtr->SetFloat(OSPLINEDATAAXIS_ARROW_OVERSHOOT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_OVERSHOOT);
+	objectDataPtr->SetBool(OSPLINEDATAAXIS_TICKS, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICKS);
+	objectDataPtr->SetFloat(OSPLINEDATAAXIS_TICK_SPACING_X, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_X);
+	objectDataPtr->SetFloat(OSPLINEDATAAXIS_TICK_SPACING_Y, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_Y);
+	objectDataPtr->SetInt32(OSPLINEDATAAXIS_TICK_MINOR_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_SUBDIVISION);
+	objectDataPtr->SetFloat(OSPLINEDATAAXIS_TICK_MAJOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MAJOR_LENGTH);
+	objectDataPtr->SetFloat(OSPLINEDATAAXIS_TICK_MINOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_LENGTH);
+	objectDataPtr->SetBool(OSPLINEDATAAXIS_GRID, SplineDataVisualizationHelpers::DEFAULT_AXIS_GRID);
+	objectDataPtr->SetInt32(OSPLINEDATAAXIS_SCALE, OSPLINEDATAAXIS_SCALE_LINEAR);
+	objectDataPtr->SetFloat(OSPLINEDATAAXIS_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	objectDataPtr->SetFloat(OSPLINEDATAAXIS_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
 
 	// SplineObject standard parameters
 	objectDataPtr->SetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_LINEAR);
@@ -253,8 +212,16 @@ SplineObject* SplineDataAxisSplineObject::GetContour(BaseObject *op, BaseDocumen
 	if (!op)
 		return nullptr;
 
+	// The contour may already have been built by the regeneration scheduler
+	return TakeContour(*op, bt);
+}
+
+SplineObject* SplineDataAxisSplineObject::BuildContour(BaseObject &op, BaseThread *bt)
+{
 	// Retrieve the BaseContainer object belonging to the generator.
-	BaseContainer* objectDataPtr = op->GetDataInstance();
+	BaseContainer* objectDataPtr = op.GetDataInstance();
+	if (!objectDataPtr)
+		return nullptr;
 
 	// Fill the retrieve BaseContainer object with initial values.
 	const Float width = objectDataPtr->GetFloat(OSPLINEDATAAXIS_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
@@ -264,6 +231,17 @@ SplineObject* SplineDataAxisSplineObject::GetContour(BaseObject *op, BaseDocumen
 	const Float arrowHeight = objectDataPtr->GetFloat(OSPLINEDATAAXIS_ARROW_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_HEIGHT);
 	const Float arrowWidth = objectDataPtr->GetFloat(OSPLINEDATAAXIS_ARROW_WIDTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_WIDTH);
 	const Float arrowOvershoot = objectDataPtr->GetFloat(OSPLINEDATAAXIS_ARROW_OVERSHOOT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_OVERSHOOT);
+	const Bool ticks = objectDataPtr->GetBool(OSPLINEDATAAXIS_TICKS, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICKS);
+	const Float tickSpacingX = objectDataPtr->GetFloat(OSPLINEDATAAXIS_TICK_SPACING_X, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_X);
+	const Float tickSpacingY = objectDataPtr->GetFloat(OSPLINEDATAAXIS_TICK_SPACING_Y, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_Y);
+	const SplineDataVisualizationHelpers::SCALETYPE scaleType = (SplineDataVisualizationHelpers::SCALETYPE)objectDataPtr->GetInt32(OSPLINEDATAAXIS_SCALE, OSPLINEDATAAXIS_SCALE_LINEAR);
+	const Float scaleMin = objectDataPtr->GetFloat(OSPLINEDATAAXIS_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	const Float scaleMax = objectDataPtr->GetFloat(OSPLINEDATAAXIS_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
+	const SplineDataVisualizationHelpers::ScaleMapping scaleY(scaleType, scaleMin, scaleMax, height);
+	const Int32 tickMinorSubdivision = Max(objectDataPtr->GetInt32(OSPLINEDATAAXIS_TICK_MINOR_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_SUBDIVISION), (Int32)1);
+	const Float tickMajorLength = objectDataPtr->GetFloat(OSPLINEDATAAXIS_TICK_MAJOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MAJOR_LENGTH);
+	const Float tickMinorLength = objectDataPtr->GetFloat(OSPLINEDATAAXIS_TICK_MINOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_LENGTH);
+	const Bool grid = objectDataPtr->GetBool(OSPLINEDATAAXIS_GRID, SplineDataVisualizationHelpers::DEFAULT_AXIS_GRID);
 
 	const Bool closed = objectDataPtr->GetBool(SPLINEOBJECT_CLOSED, false);
 	const SPLINETYPE splineType = (SPLINETYPE)objectDataPtr->GetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_LINEAR);
@@ -273,15 +251,18 @@ SplineObject* SplineDataAxisSplineObject::GetContour(BaseObject *op, BaseDocumen
 	const Float splineMaxLength = objectDataPtr->GetFloat(SPLINEOBJECT_MAXIMUMLENGTH, 0.0);
 
 	// Set parameters to params set
-	SplineDataVisualizationHelpers::SplineDataAxisSplineParameters params(height, width, overshoot, arrows, arrowHeight, arrowWidth, arrowOvershoot, closed, splineType, splineInterpolation, splineSubdivision, splineAngle, splineMaxLength);
+	SplineDataVisualizationHelpers::SplineDataAxisSplineParameters params(height, width, overshoot, arrows, arrowHeight, arrowWidth, arrowOvershoot, ticks, tickSpacingX, tickSpacingY, scaleY, tickMinorSubdivision, tickMajorLength, tickMinorLength, grid, closed, splineType, splineInterpolation, splineSubdivision, splineAngle, splineMaxLength);
+
+	// The tick layout sizes the spline and is written into it, it is only computed once
+	const SplineDataVisualizationHelpers::SplineDataAxisTickLayout tickLayout = SplineDataVisualizationHelpers::GetAxisTickLayout(params);
 
 	// Alloc a SplineObject and check it.
-	SplineObject* splineObjPtr = SplineObject::Alloc(SplineDataVisualizationHelpers::GetNumberOfRequiredSplinePoints(params.arrows), params.splineType);
+	SplineObject* splineObjPtr = SplineObject::Alloc(SplineDataVisualizationHelpers::GetNumberOfRequiredSplinePoints(params, tickLayout), params.splineType);
 	if (!splineObjPtr)
 		return nullptr;
 
 	// Invoke the helper function to set the SplineObject object member accordingly
-	iferr (SplineDataVisualizationHelpers::CreateSplineDataAxisSpline(*splineObjPtr, params))
+	iferr (SplineDataVisualizationHelpers::CreateSplineDataAxisSpline(*splineObjPtr, params, tickLayout))
 	{
 		DiagnosticOutput("Error on CreateSplineDataAxisSpline: @", err);
 		SplineObject::Free(splineObjPtr);
@@ -293,6 +274,18 @@ SplineObject* SplineDataAxisSplineObject::GetContour(BaseObject *op, BaseDocumen
 	return splineObjPtr;
 }
 
+Bool SplineDataAxisSplineObject::Message(GeListNode* node, Int32 type, void* data)
+{
+	// Hand the regeneration job to the scheduler
+	if (type == SplineDataVisualizationHelpers::MSG_SPLINEDATA_GETREGENERATIONJOB && data)
+	{
+		static_cast<SplineDataVisualizationHelpers::SplineDataRegenerationJobMessage*>(data)->job = this;
+		return true;
+	}
+
+	return SUPER::Message(node, type, data);
+}
+
 Bool SplineDataAxisSplineObject::GetDEnabling(GeListNode *node, const DescID &id, const GeData &t_data, DESCFLAGS_ENABLE flags, const BaseContainer *itemdesc)
 {
 	// Check the passed pointer.
@@ -312,6 +305,14 @@ Bool SplineDataAxisSplineObject::GetDEnabling(GeListNode *node, const DescID &id
 		case OSPLINEDATAAXIS_ARROW_WIDTH:
 		case OSPLINEDATAAXIS_ARROW_OVERSHOOT:
 			return objectDataPtr->GetBool(OSPLINEDATAAXIS_ARROWS);
+		case OSPLINEDATAAXIS_TICK_MAJOR_LENGTH:
+		case OSPLINEDATAAXIS_TICK_MINOR_LENGTH:
+			return objectDataPtr->GetBool(OSPLINEDATAAXIS_TICKS);
+		case OSPLINEDATAAXIS_TICK_SPACING_X:
+		case OSPLINEDATAAXIS_TICK_MINOR_SUBDIVISION:
+			return objectDataPtr->GetBool(OSPLINEDATAAXIS_TICKS) || objectDataPtr->GetBool(OSPLINEDATAAXIS_GRID);
+		case OSPLINEDATAAXIS_TICK_SPACING_Y:
+			return (objectDataPtr->GetBool(OSPLINEDATAAXIS_TICKS) || objectDataPtr->GetBool(OSPLINEDATAAXIS_GRID)) && objectDataPtr->GetInt32(OSPLINEDATAAXIS_SCALE) == OSPLINEDATAAXIS_SCALE_LINEAR;
 
 		// SplineObject standard attributes
 		case SPLINEOBJECT_ANGLE:
@@ -0,0 +1,380 @@
+// Includes from API
+#include "c4d_baseobject.h"
+#include "c4d_includes.h"
+#include "c4d_objectdata.h"
+
+// Includes from plugin project
+#include "c4d_symbols.h"
+#include "main.h"
+
+// Local resources
+#include "osplinedatachart.h"
+#include "c4d_resource.h"
+
+// Common values
+#include "commons.h"
+#include "sampling.h"
+#include "regenerationjob.h"
+#include "core/axislayout.h"
+#include "core/curvelayout.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// Struct to hold chart generation parameters
+	//----------------------------------------------------------------------------------------
+	struct SplineDataChartParameters : public SplineDataAxisLayoutParameters
+	{
+		UInt32 samples;
+		const Float32 *values;
+
+		Bool closed;
+		SPLINETYPE splineType;
+		Int32 splineInterpolation;
+		Int32 splineSubdivision;
+		Float splineSubAngle;
+		Float splineSubMaxLength;
+
+		/// \brief Default constructor
+		SplineDataChartParameters() : SplineDataAxisLayoutParameters(),
+			samples(0), values(nullptr),
+			closed(false), splineType(SPLINETYPE::LINEAR),
+			splineInterpolation(SPLINEOBJECT_INTERPOLATION_NONE),
+			splineSubdivision(0), splineSubAngle(0.0),
+			splineSubMaxLength(0.0)
+		{
+		}
+
+		/// \brief Contruct from values
+		SplineDataChartParameters(const SplineDataAxisLayoutParameters &_axis,
+															UInt32 _samples,
+															const Float32 *_values,
+															Bool _closed,
+															SPLINETYPE _splineType,
+															Int32 _splineInterpolation,
+															Int32 _splineSubdivision,
+															Float _splineSubAngle,
+															Float _splineSubMaxLength) :
+			SplineDataAxisLayoutParameters(_axis),
+			samples(_samples), values(_values),
+			closed(_closed), splineType(_splineType),
+			splineInterpolation(_splineInterpolation),
+			splineSubdivision(_splineSubdivision),
+			splineSubAngle(_splineSubAngle),
+			splineSubMaxLength(_splineSubMaxLength)
+		{
+		}
+	};
+
+	/// \brief Return number of required points for axes, arrows, ticks, grid lines and the curve
+	inline Int32 GetNumberOfRequiredChartPoints(const SplineDataChartParameters &params, const SplineDataAxisTickLayout &tickLayout)
+	{
+		return (Int32)GetNumberOfRequiredSplinePoints(params, tickLayout) + (Int32)params.samples;
+	}
+
+	/// \brief Return number of required segments for axes, arrows, ticks, grid lines and the curve
+	inline Int32 GetNumberOfRequiredChartSegments(const SplineDataChartParameters &params, const SplineDataAxisTickLayout &tickLayout)
+	{
+		return (Int32)GetNumberOfRequiredSplineSegments(params, tickLayout) + 1;
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Global function responsible to create the spline points.
+	/// The axis system comes first, the curve is the last segment.
+	/// @brief Global function responsible to create the spline points.
+	/// @param[out] splineObj					SplineObject that will receive the resulting points
+	/// @param[in] params							Parameter set for spline generation
+	/// @param[in] tickLayout					Tick and grid line counts of params
+	/// @return												True if creation process succeeds
+	//----------------------------------------------------------------------------------------
+	static maxon::Result<void> CreateSplineDataChart(SplineObject& splineObj, SplineDataChartParameters &params, const SplineDataAxisTickLayout &tickLayout)
+	{
+		if (!params.values || params.samples < 2)
+			return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+
+		// Set the closed/open status of the SplineObject instance accessing its BaseContainer instance
+		BaseContainer* splineObjBCPtr = splineObj.GetDataInstance();
+		if (splineObjBCPtr)
+		{
+			splineObjBCPtr->SetBool(SPLINEOBJECT_CLOSED, params.closed);
+			splineObjBCPtr->SetInt32(SPLINEOBJECT_INTERPOLATION, params.splineInterpolation);
+			splineObjBCPtr->SetInt32(SPLINEOBJECT_SUB, params.splineSubdivision);
+			splineObjBCPtr->SetFloat(SPLINEOBJECT_ANGLE, params.splineSubAngle);
+			splineObjBCPtr->SetFloat(SPLINEOBJECT_MAXIMUMLENGTH, params.splineSubMaxLength);
+		}
+
+		// Set the number of segments
+		const Int32 segmentCount = GetNumberOfRequiredChartSegments(params, tickLayout);
+		if (splineObj.GetPointCount() != GetNumberOfRequiredChartPoints(params, tickLayout))
+			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
+		if (!splineObj.MakeVariableTag(Tsegment, segmentCount))
+			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
+
+		// Access the writable array of the points representing the curve passing points
+		Vector* splinePntsPtr = splineObj.GetPointW();
+		if (nullptr == splinePntsPtr)
+			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
+
+		// Access the curve's segments array.
+		Segment* splineSegsPtr = splineObj.GetSegmentW();
+		if (nullptr == splineSegsPtr)
+			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
+
+		// Set axes, arrows, ticks and grid lines
+		WriteSplineDataAxisLayout(params, tickLayout, splinePntsPtr, splineSegsPtr);
+
+		// Append the curve, mapped with the same scale as the y axis
+		const Int32 curveFirstPoint = (Int32)GetNumberOfRequiredSplinePoints(params, tickLayout);
+		const Float xStep = params.width / ((Float)params.samples - 1);
+		WriteSplineDataCurvePoints(splinePntsPtr + curveFirstPoint, SplineDataCurveOverlays<Vector>(), params.values, (const Float32*)nullptr, 0.0, params.samples, 0.0, xStep, params.scaleY);
+		splineSegsPtr[segmentCount - 1].closed = params.closed;
+		splineSegsPtr[segmentCount - 1].cnt = (Int32)params.samples;
+
+		return maxon::OK;
+	}
+}
+
+
+//------------------------------------------------------------------------------------------------
+/// ObjectData implementation generating a complete chart, the axis system and the curve, in one spline
+//------------------------------------------------------------------------------------------------
+class SplineDataChartObject : public ObjectData, public SplineDataVisualizationHelpers::SplineDataRegenerationJob
+{
+	INSTANCEOF(SplineDataChartObject, ObjectData)
+
+public:
+	virtual Bool Init(GeListNode* node);
+	virtual void GetDimension(BaseObject* op, Vector* mp, Vector* rad);
+	virtual SplineObject* GetContour(BaseObject* op, BaseDocument* doc, Float lod, BaseThread* bt);
+	virtual SplineObject* BuildContour(BaseObject& op, BaseThread* bt);
+	virtual Bool Message(GeListNode* node, Int32 type, void* data);
+	Bool GetDEnabling(GeListNode *node, const DescID &id, const GeData &t_data, DESCFLAGS_ENABLE flags, const BaseContainer *itemdesc);
+
+	static NodeData* Alloc()
+	{
+		return NewObj(SplineDataChartObject) iferr_ignore("SplineDataChartObject plugin not instanced");
+	}
+
+private:
+	SplineDataVisualizationHelpers::SplineDataSampleCache _sampleCache; ///< Samples of the SplineData curve
+};
+
+Bool SplineDataChartObject::Init(GeListNode* node)
+{
+	if (!node)
+		return false;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseObject*		 baseObjectPtr = static_cast<BaseObject*>(node);
+	BaseContainer* objectDataPtr = baseObjectPtr->GetDataInstance();
+
+	// Fill object container with initial values
+	objectDataPtr->SetFloat(OSPLINEDATACHART_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
+	objectDataPtr->SetUInt32(OSPLINEDATACHART_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION);
+	objectDataPtr->SetInt32(OSPLINEDATACHART_SCALE, OSPLINEDATACHART_SCALE_LINEAR);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
+
+	GeData geSplineData(CUSTOMDATATYPE_SPLINE, DEFAULTVALUE);
+	SplineData *splineData = (SplineData*)geSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
+	splineData->MakeLinearSplineBezier(2);
+	objectDataPtr->SetData(OSPLINEDATACHART_SPLINECURVE, geSplineData);
+
+	// Axis system
+	objectDataPtr->SetFloat(OSPLINEDATACHART_OVERSHOOT, SplineDataVisualizationHelpers::DEFAULT_AXIS_OVERSHOOT);
+	objectDataPtr->SetBool(OSPLINEDATACHART_ARROWS, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROWS);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_ARROW_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_HEIGHT);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_ARROW_WIDTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_WIDTH);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_ARROW_OVERSHOOT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_OVERSHOOT);
+	objectDataPtr->SetBool(OSPLINEDATACHART_TICKS, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICKS);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_TICK_SPACING_X, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_X);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_TICK_SPACING_Y, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_Y);
+	objectDataPtr->SetInt32(OSPLINEDATACHART_TICK_MINOR_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_SUBDIVISION);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_TICK_MAJOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MAJOR_LENGTH);
+	objectDataPtr->SetFloat(OSPLINEDATACHART_TICK_MINOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_LENGTH);
+	objectDataPtr->SetBool(OSPLINEDATACHART_GRID, SplineDataVisualizationHelpers::DEFAULT_AXIS_GRID);
+
+	// SplineObject standard parameters. The spline is linear, so the axes and arrows stay straight;
+	// the curve is smooth enough with its subdivisions.
+	objectDataPtr->SetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_LINEAR);
+	objectDataPtr->SetBool(SPLINEOBJECT_CLOSED, false);
+	objectDataPtr->SetInt32(SPLINEOBJECT_INTERPOLATION, SPLINEOBJECT_INTERPOLATION_NATURAL);
+	objectDataPtr->SetInt32(SPLINEOBJECT_SUB, 8);
+	objectDataPtr->SetFloat(SPLINEOBJECT_ANGLE, DegToRad(5.0));
+	objectDataPtr->SetFloat(SPLINEOBJECT_MAXIMUMLENGTH, 5.0);
+
+	return true;
+}
+
+void SplineDataChartObject::GetDimension(BaseObject *op, Vector *mp, Vector *rad)
+{
+	// Check the passed pointers.
+	if (!op || ! mp || !rad)
+		return;
+
+	// Reset the barycenter position and the bbox radius vector.
+	mp->SetZero();
+	rad->SetZero();
+
+	// Set the barycenter position to match the generator center.
+	const Vector objGlobalOffset = op->GetMg().off;
+	mp->x = objGlobalOffset.x;
+	mp->y = objGlobalOffset.y;
+	mp->z = objGlobalOffset.z;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = op->GetDataInstance();
+	if (!objectDataPtr)
+		return;
+
+	// Set radius values accordingly to the bbox values stored during the init, including the arrows.
+	const Float a = Max(objectDataPtr->GetFloat(OSPLINEDATACHART_OVERSHOOT), objectDataPtr->GetBool(OSPLINEDATACHART_ARROWS) ? (objectDataPtr->GetFloat(OSPLINEDATACHART_ARROW_WIDTH) * 0.5) : 0.0) + objectDataPtr->GetFloat(OSPLINEDATACHART_ARROW_OVERSHOOT) + objectDataPtr->GetFloat(OSPLINEDATACHART_ARROW_HEIGHT) * 0.5;
+	rad->x = objectDataPtr->GetFloat(OSPLINEDATACHART_WIDTH) + a;
+	rad->y = objectDataPtr->GetFloat(OSPLINEDATACHART_HEIGHT) + a;
+}
+
+SplineObject* SplineDataChartObject::GetContour(BaseObject *op, BaseDocument *doc, Float lod, BaseThread *bt)
+{
+	// Check the passed pointer.
+	if (!op)
+		return nullptr;
+
+	// The contour may already have been built by the regeneration scheduler
+	return TakeContour(*op, bt);
+}
+
+SplineObject* SplineDataChartObject::BuildContour(BaseObject &op, BaseThread *bt)
+{
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = op.GetDataInstance();
+	if (!objectDataPtr)
+		return nullptr;
+
+	// Fill the retrieve BaseContainer object with initial values.
+	const Float width = objectDataPtr->GetFloat(OSPLINEDATACHART_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
+	const Float height = objectDataPtr->GetFloat(OSPLINEDATACHART_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
+	const UInt32 samples = objectDataPtr->GetUInt32(OSPLINEDATACHART_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION) + 1;
+	const SplineDataVisualizationHelpers::SCALETYPE scaleType = (SplineDataVisualizationHelpers::SCALETYPE)objectDataPtr->GetInt32(OSPLINEDATACHART_SCALE, OSPLINEDATACHART_SCALE_LINEAR);
+	const Float scaleMin = objectDataPtr->GetFloat(OSPLINEDATACHART_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	const Float scaleMax = objectDataPtr->GetFloat(OSPLINEDATACHART_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
+	const SplineDataVisualizationHelpers::ScaleMapping scaleY(scaleType, scaleMin, scaleMax, height);
+	GeData geSplineData = objectDataPtr->GetData(OSPLINEDATACHART_SPLINECURVE);
+	SplineData *splineData = (SplineData*)geSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
+	if (!splineData)
+		return nullptr;
+
+	const Float overshoot = objectDataPtr->GetFloat(OSPLINEDATACHART_OVERSHOOT, SplineDataVisualizationHelpers::DEFAULT_AXIS_OVERSHOOT);
+	const Bool arrows = objectDataPtr->GetBool(OSPLINEDATACHART_ARROWS, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROWS);
+	const Float arrowHeight = objectDataPtr->GetFloat(OSPLINEDATACHART_ARROW_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_HEIGHT);
+	const Float arrowWidth = objectDataPtr->GetFloat(OSPLINEDATACHART_ARROW_WIDTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_WIDTH);
+	const Float arrowOvershoot = objectDataPtr->GetFloat(OSPLINEDATACHART_ARROW_OVERSHOOT, SplineDataVisualizationHelpers::DEFAULT_AXIS_ARROW_OVERSHOOT);
+	const Bool ticks = objectDataPtr->GetBool(OSPLINEDATACHART_TICKS, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICKS);
+	const Float tickSpacingX = objectDataPtr->GetFloat(OSPLINEDATACHART_TICK_SPACING_X, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_X);
+	const Float tickSpacingY = objectDataPtr->GetFloat(OSPLINEDATACHART_TICK_SPACING_Y, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_SPACING_Y);
+	const Int32 tickMinorSubdivision = Max(objectDataPtr->GetInt32(OSPLINEDATACHART_TICK_MINOR_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_SUBDIVISION), (Int32)1);
+	const Float tickMajorLength = objectDataPtr->GetFloat(OSPLINEDATACHART_TICK_MAJOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MAJOR_LENGTH);
+	const Float tickMinorLength = objectDataPtr->GetFloat(OSPLINEDATACHART_TICK_MINOR_LENGTH, SplineDataVisualizationHelpers::DEFAULT_AXIS_TICK_MINOR_LENGTH);
+	const Bool grid = objectDataPtr->GetBool(OSPLINEDATACHART_GRID, SplineDataVisualizationHelpers::DEFAULT_AXIS_GRID);
+
+	// Sample the curve, it is only re-sampled if it has changed since the last call
+	iferr (_sampleCache.Update(splineData, samples))
+	{
+		DiagnosticOutput("Error on sampling SplineData: @", err);
+		return nullptr;
+	}
+
+	const Bool closed = objectDataPtr->GetBool(SPLINEOBJECT_CLOSED, false);
+	const SPLINETYPE splineType = (SPLINETYPE)objectDataPtr->GetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_LINEAR);
+	const Int32 splineInterpolation = objectDataPtr->GetInt32(SPLINEOBJECT_INTERPOLATION, SPLINEOBJECT_INTERPOLATION_NONE);
+	const Int32 splineSubdivision = objectDataPtr->GetInt32(SPLINEOBJECT_SUB, 0);
+	const Float splineAngle = objectDataPtr->GetFloat(SPLINEOBJECT_ANGLE, 0.0);
+	const Float splineMaxLength = objectDataPtr->GetFloat(SPLINEOBJECT_MAXIMUMLENGTH, 0.0);
+
+	// Set parameters to params set
+	const SplineDataVisualizationHelpers::SplineDataAxisLayoutParameters axis(height, width, overshoot, arrows, arrowHeight, arrowWidth, arrowOvershoot, ticks, tickSpacingX, tickSpacingY, scaleY, tickMinorSubdivision, tickMajorLength, tickMinorLength, grid);
+	SplineDataVisualizationHelpers::SplineDataChartParameters params(axis, samples, _sampleCache.GetValues(), closed, splineType, splineInterpolation, splineSubdivision, splineAngle, splineMaxLength);
+
+	// The tick layout sizes the spline and is written into it, it is only computed once
+	const SplineDataVisualizationHelpers::SplineDataAxisTickLayout tickLayout = SplineDataVisualizationHelpers::GetAxisTickLayout(params);
+
+	// Alloc a SplineObject holding the axis system and the curve, and check it.
+	SplineObject* splineObjPtr = SplineObject::Alloc(SplineDataVisualizationHelpers::GetNumberOfRequiredChartPoints(params, tickLayout), params.splineType);
+	if (!splineObjPtr)
+		return nullptr;
+
+	// Invoke the helper function to set the SplineObject object member accordingly
+	iferr (SplineDataVisualizationHelpers::CreateSplineDataChart(*splineObjPtr, params, tickLayout))
+	{
+		DiagnosticOutput("Error on CreateSplineDataChart: @", err);
+		SplineObject::Free(splineObjPtr);
+		return nullptr;
+	}
+
+	splineObjPtr->Message(MSG_UPDATE);
+
+	return splineObjPtr;
+}
+
+Bool SplineDataChartObject::Message(GeListNode* node, Int32 type, void* data)
+{
+	// Hand the regeneration job to the scheduler
+	if (type == SplineDataVisualizationHelpers::MSG_SPLINEDATA_GETREGENERATIONJOB && data)
+	{
+		static_cast<SplineDataVisualizationHelpers::SplineDataRegenerationJobMessage*>(data)->job = this;
+		return true;
+	}
+
+	return SUPER::Message(node, type, data);
+}
+
+Bool SplineDataChartObject::GetDEnabling(GeListNode *node, const DescID &id, const GeData &t_data, DESCFLAGS_ENABLE flags, const BaseContainer *itemdesc)
+{
+	// Check the passed pointer.
+	if (!node)
+		return false;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = static_cast<BaseObject*>(node)->GetDataInstance();
+	if (!objectDataPtr)
+		return false;
+
+	Int32 interpolation = objectDataPtr->GetInt32(SPLINEOBJECT_INTERPOLATION);
+	switch (id[0].id)
+	{
+		// Axis system attributes
+		case OSPLINEDATACHART_ARROW_HEIGHT:
+		case OSPLINEDATACHART_ARROW_WIDTH:
+		case OSPLINEDATACHART_ARROW_OVERSHOOT:
+			return objectDataPtr->GetBool(OSPLINEDATACHART_ARROWS);
+		case OSPLINEDATACHART_TICK_MAJOR_LENGTH:
+		case OSPLINEDATACHART_TICK_MINOR_LENGTH:
+			return objectDataPtr->GetBool(OSPLINEDATACHART_TICKS);
+		case OSPLINEDATACHART_TICK_SPACING_X:
+		case OSPLINEDATACHART_TICK_MINOR_SUBDIVISION:
+			return objectDataPtr->GetBool(OSPLINEDATACHART_TICKS) || objectDataPtr->GetBool(OSPLINEDATACHART_GRID);
+		case OSPLINEDATACHART_TICK_SPACING_Y:
+			return (objectDataPtr->GetBool(OSPLINEDATACHART_TICKS) || objectDataPtr->GetBool(OSPLINEDATACHART_GRID)) && objectDataPtr->GetInt32(OSPLINEDATACHART_SCALE) == OSPLINEDATACHART_SCALE_LINEAR;
+
+		// SplineObject standard attributes
+		case SPLINEOBJECT_ANGLE:
+			return interpolation == SPLINEOBJECT_INTERPOLATION_ADAPTIVE || interpolation == SPLINEOBJECT_INTERPOLATION_SUBDIV;
+		case SPLINEOBJECT_MAXIMUMLENGTH:
+			return interpolation == SPLINEOBJECT_INTERPOLATION_SUBDIV;
+		case SPLINEOBJECT_SUB:
+			return interpolation == SPLINEOBJECT_INTERPOLATION_NATURAL || interpolation == SPLINEOBJECT_INTERPOLATION_UNIFORM;
+	}
+
+	return SUPER::GetDEnabling(node, id, t_data, flags, itemdesc);
+}
+
+
+Bool RegisterSplineDataChart()
+{
+	String registeredName = GeLoadString(IDS_OBJECTDATA_SPLINEDATACHART);
+	if (!registeredName.IsPopulated())
+		return false;
+
+	return RegisterObjectPlugin(SplineDataVisualizationHelpers::ID_OBJECTDATA_SPLINEDATACHART, registeredName, OBJECT_GENERATOR|OBJECT_ISSPLINE, SplineDataChartObject::Alloc, "osplinedatachart"_s, AutoBitmap("osplinedataaxisspline.tif"_s), 0);
+}
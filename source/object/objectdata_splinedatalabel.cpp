@@ -0,0 +1,403 @@
+// Includes from API
+#include "c4d_baseobject.h"
+#include "c4d_includes.h"
+#include "c4d_objectdata.h"
+#include "customgui_fontchooser.h"
+#include "maxon/hashmap.h"
+#include "maxon/spinlock.h"
+
+// Includes from plugin project
+#include "c4d_symbols.h"
+#include "main.h"
+
+// Local resources
+#include "osplinedatalabel.h"
+#include "c4d_resource.h"
+
+// Common values
+#include "commons.h"
+#include "sampling.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// Extruded mesh of a single glyph at a text height of 1.0 and a depth of 1.0, -1.0 or 0.0
+	/// (flat), moved so its left edge is at x = 0. Labels scale x and y by their text height,
+	/// and z by the amount of their depth.
+	//----------------------------------------------------------------------------------------
+	struct SplineDataGlyph
+	{
+		maxon::BaseArray<Vector> points;
+		maxon::BaseArray<CPolygon> polygons;
+		Float advance = 0.0; ///< Horizontal distance to the next glyph, relative to the text height
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Key of a glyph in the glyph cache
+	//----------------------------------------------------------------------------------------
+	struct SplineDataGlyphKey
+	{
+		Int fontIndex;
+		Utf32Char character;
+		Int32 depthSign; ///< Direction of the extrusion: 1, -1, or 0 for flat glyphs
+
+		Bool operator ==(const SplineDataGlyphKey &other) const
+		{
+			return fontIndex == other.fontIndex && character == other.character && depthSign == other.depthSign;
+		}
+
+		maxon::HashInt GetHashCode() const
+		{
+			UInt64 hash = 14695981039346656037ULL;
+			HashCombine(hash, fontIndex);
+			HashCombine(hash, character);
+			HashCombine(hash, depthSign);
+			return (maxon::HashInt)hash;
+		}
+	};
+
+	/// \brief Returns the direction of an extrusion depth, 0 for flat glyphs
+	inline Int32 GetGlyphDepthSign(Float depth)
+	{
+		return depth > 0.0 ? 1 : (depth < 0.0 ? -1 : 0);
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Process-wide cache of extruded glyph meshes per font, character and extrusion direction.
+	/// Glyphs are built once at unit height and depth, with a temporary Text spline and Extrude
+	/// object, and shared by all labels regardless of their text height and depth, so animating
+	/// either doesn't add glyphs. Cached glyphs are never modified or removed until the plugin ends.
+	//----------------------------------------------------------------------------------------
+	class SplineDataGlyphCache
+	{
+	public:
+		//----------------------------------------------------------------------------------------
+		/// Returns a cached glyph, and builds it if it is not cached yet.
+		/// The lock is only held for the lookups, not while the glyph is built, so labels
+		/// don't wait for each other's modeling commands. If two threads build the same glyph,
+		/// the first one inserted is kept.
+		/// @brief Returns a cached glyph.
+		/// @param[in] font								The font
+		/// @param[in] character					The character
+		/// @param[in] depthSign					Direction of the extrusion, see GetGlyphDepthSign()
+		/// @return												The glyph, stays valid until Free() is called
+		//----------------------------------------------------------------------------------------
+		maxon::Result<const SplineDataGlyph*> GetGlyph(const BaseContainer &font, Utf32Char character, Int32 depthSign)
+		{
+			iferr_scope;
+
+			SplineDataGlyphKey key = { NOTOK, character, depthSign };
+			{
+				maxon::ScopedLock lock(_lock);
+
+				// Fonts are compared by their container, and referenced by index
+				for (Int index = 0; index < _fonts.GetCount(); ++index)
+				{
+					if (_fonts[index] == font)
+					{
+						key.fontIndex = index;
+						break;
+					}
+				}
+				if (key.fontIndex == NOTOK)
+				{
+					_fonts.Append(font) iferr_return;
+					key.fontIndex = _fonts.GetCount() - 1;
+				}
+
+				const SplineDataGlyph *cachedGlyph = _glyphs.FindValue(key);
+				if (cachedGlyph)
+					return cachedGlyph;
+			}
+
+			SplineDataGlyph glyph;
+			BuildGlyph(font, character, depthSign, glyph) iferr_return;
+
+			maxon::ScopedLock lock(_lock);
+			const SplineDataGlyph *cachedGlyph = _glyphs.FindValue(key);
+			if (cachedGlyph)
+				return cachedGlyph;
+			auto &entry = _glyphs.Insert(key, std::move(glyph)) iferr_return;
+			return &entry.GetValue();
+		}
+
+		/// \brief Frees all cached glyphs
+		void Free()
+		{
+			maxon::ScopedLock lock(_lock);
+			_glyphs.Reset();
+			_fonts.Reset();
+		}
+
+	private:
+		/// \brief Builds the extruded mesh of a glyph, with a depth of depthSign
+		static maxon::Result<void> BuildGlyph(const BaseContainer &font, Utf32Char character, Int32 depthSign, SplineDataGlyph &glyph)
+		{
+			iferr_scope;
+
+			glyph.advance = LABEL_GLYPH_GAP;
+
+			// Whitespace has no outline
+			if (character == ' ' || character == '\t')
+			{
+				glyph.advance = LABEL_SPACE_ADVANCE;
+				return maxon::OK;
+			}
+
+			// Set up a temporary document with a Text spline in an Extrude object
+			AutoAlloc<BaseDocument> doc;
+			BaseObject *extrudeObject = BaseObject::Alloc(Oextrude);
+			BaseObject *textObject = BaseObject::Alloc(Osplinetext);
+			if (!doc || !extrudeObject || !textObject)
+			{
+				BaseObject::Free(extrudeObject);
+				BaseObject::Free(textObject);
+				return maxon::OutOfMemoryError(MAXON_SOURCE_LOCATION, "Could not allocate glyph objects!"_s);
+			}
+
+			FontData fontData;
+			fontData.SetFont(const_cast<BaseContainer*>(&font));
+			BaseContainer *textObjectDataPtr = textObject->GetDataInstance();
+			BaseContainer *extrudeDataPtr = extrudeObject->GetDataInstance();
+			if (textObjectDataPtr && extrudeDataPtr)
+			{
+				textObjectDataPtr->SetInt32(PRIM_PLANE, PRIM_PLANE_XY);
+				textObjectDataPtr->SetString(PRIM_TEXT_TEXT, String(1, character));
+				textObjectDataPtr->SetFloat(PRIM_TEXT_HEIGHT, 1.0);
+				textObjectDataPtr->SetData(PRIM_TEXT_FONT, GeData(FONTCHOOSER_DATA, fontData));
+				extrudeDataPtr->SetVector(EXTRUDEOBJECT_MOVE, Vector(0.0, 0.0, (Float)depthSign));
+			}
+			textObject->InsertUnder(extrudeObject);
+			doc->InsertObject(extrudeObject, nullptr, nullptr);
+
+			// Current state of the extrusion, joined into one polygon object
+			ModelingCommandData stateCommand;
+			stateCommand.doc = doc;
+			stateCommand.op = extrudeObject;
+			if (!SendModelingCommand(MCOMMAND_CURRENTSTATETOOBJECT, stateCommand) || !stateCommand.result)
+				return maxon::UnexpectedError(MAXON_SOURCE_LOCATION, "Could not build glyph!"_s);
+			BaseObject *stateObject = static_cast<BaseObject*>(stateCommand.result->GetIndex(0));
+			AtomArray::Free(stateCommand.result);
+			if (!stateObject)
+				return maxon::UnexpectedError(MAXON_SOURCE_LOCATION, "Could not build glyph!"_s);
+			doc->InsertObject(stateObject, nullptr, nullptr);
+
+			ModelingCommandData joinCommand;
+			joinCommand.doc = doc;
+			joinCommand.op = stateObject;
+			if (!SendModelingCommand(MCOMMAND_JOIN, joinCommand) || !joinCommand.result)
+				return maxon::UnexpectedError(MAXON_SOURCE_LOCATION, "Could not join glyph!"_s);
+			BaseObject *joinedObject = static_cast<BaseObject*>(joinCommand.result->GetIndex(0));
+			AtomArray::Free(joinCommand.result);
+			AutoFree<BaseObject> joinedObjectOwner(joinedObject);
+
+			// Glyphs without an outline only advance
+			if (!joinedObject || !joinedObject->IsInstanceOf(Opolygon))
+				return maxon::OK;
+
+			PolygonObject *polyObject = static_cast<PolygonObject*>(joinedObject);
+			const Int32 pointCount = polyObject->GetPointCount();
+			const Int32 polygonCount = polyObject->GetPolygonCount();
+			const Vector *points = polyObject->GetPointR();
+			const CPolygon *polygons = polyObject->GetPolygonR();
+			if (pointCount == 0 || !points || !polygons)
+				return maxon::OK;
+
+			// Move the glyph to x = 0, the advance is its width plus a gap
+			Float minX = points[0].x;
+			Float maxX = points[0].x;
+			for (Int32 pointIndex = 1; pointIndex < pointCount; ++pointIndex)
+			{
+				minX = Min(minX, points[pointIndex].x);
+				maxX = Max(maxX, points[pointIndex].x);
+			}
+
+			glyph.points.Resize(pointCount) iferr_return;
+			for (Int32 pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+				glyph.points[pointIndex] = Vector(points[pointIndex].x - minX, points[pointIndex].y, points[pointIndex].z);
+			glyph.polygons.Resize(polygonCount) iferr_return;
+			for (Int32 polygonIndex = 0; polygonIndex < polygonCount; ++polygonIndex)
+				glyph.polygons[polygonIndex] = polygons[polygonIndex];
+			glyph.advance += maxX - minX;
+
+			return maxon::OK;
+		}
+
+		maxon::Spinlock _lock;
+		maxon::BaseArray<BaseContainer> _fonts;
+		maxon::HashMap<SplineDataGlyphKey, SplineDataGlyph> _glyphs;
+	};
+
+	static SplineDataGlyphCache g_glyphCache;
+
+	//----------------------------------------------------------------------------------------
+	/// A glyph placed in a label
+	//----------------------------------------------------------------------------------------
+	struct SplineDataPlacedGlyph
+	{
+		const SplineDataGlyph *glyph;
+		Vector offset;
+	};
+}
+
+
+//------------------------------------------------------------------------------------------------
+/// ObjectData implementation generating a text label from cached glyph meshes
+//------------------------------------------------------------------------------------------------
+class SplineDataLabelObject : public ObjectData
+{
+	INSTANCEOF(SplineDataLabelObject, ObjectData)
+
+public:
+	virtual Bool Init(GeListNode* node);
+	virtual BaseObject* GetVirtualObjects(BaseObject* op, HierarchyHelp* hh);
+
+	static NodeData* Alloc()
+	{
+		return NewObj(SplineDataLabelObject) iferr_ignore("SplineDataLabelObject plugin not instanced");
+	}
+
+private:
+	maxon::BaseArray<SplineDataVisualizationHelpers::SplineDataPlacedGlyph> _placedGlyphs; ///< Layout of the label, reused between calls
+};
+
+Bool SplineDataLabelObject::Init(GeListNode* node)
+{
+	if (!node)
+		return false;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseObject*		 baseObjectPtr = static_cast<BaseObject*>(node);
+	BaseContainer* objectDataPtr = baseObjectPtr->GetDataInstance();
+
+	// Fill object container with initial values
+	objectDataPtr->SetString(OSPLINEDATALABEL_TEXT, GeLoadString(IDS_SPLINEDATAVIS_TEXT_DEFAULT));
+	objectDataPtr->SetFloat(OSPLINEDATALABEL_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_HEIGHT);
+	objectDataPtr->SetFloat(OSPLINEDATALABEL_DEPTH, SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_DEPTH);
+	objectDataPtr->SetInt32(OSPLINEDATALABEL_ALIGN, OSPLINEDATALABEL_ALIGN_LEFT);
+
+	FontData fontData;
+	objectDataPtr->SetData(OSPLINEDATALABEL_FONT, GeData(FONTCHOOSER_DATA, fontData));
+
+	return true;
+}
+
+BaseObject* SplineDataLabelObject::GetVirtualObjects(BaseObject *op, HierarchyHelp *hh)
+{
+	// Check the passed pointer.
+	if (!op)
+		return nullptr;
+
+	// Return the cache if nothing has changed
+	const Bool dirty = op->CheckCache(hh) || op->IsDirty(DIRTYFLAGS::DATA);
+	if (!dirty)
+		return op->GetCache(hh);
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = op->GetDataInstance();
+
+	const String text = objectDataPtr->GetString(OSPLINEDATALABEL_TEXT);
+	const Float height = objectDataPtr->GetFloat(OSPLINEDATALABEL_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_HEIGHT);
+	const Float depth = objectDataPtr->GetFloat(OSPLINEDATALABEL_DEPTH, SplineDataVisualizationHelpers::DEFAULT_VIS_TEXT_DEPTH);
+	const Int32 align = objectDataPtr->GetInt32(OSPLINEDATALABEL_ALIGN, OSPLINEDATALABEL_ALIGN_LEFT);
+	GeData geFontData = objectDataPtr->GetData(OSPLINEDATALABEL_FONT);
+	FontData *fontData = (FontData*)geFontData.GetCustomDataType(FONTCHOOSER_DATA);
+	BaseContainer font;
+	if (fontData)
+		font = fontData->GetFont();
+
+	// Lay out the label from cached glyphs, line by line
+	const Int32 depthSign = SplineDataVisualizationHelpers::GetGlyphDepthSign(depth);
+	Int32 pointCount = 0;
+	Int32 polygonCount = 0;
+	_placedGlyphs.Flush();
+	Int lineStart = 0;
+	Vector pen;
+	for (Int charIndex = 0; charIndex <= text.GetLength(); ++charIndex)
+	{
+		const Bool endOfText = charIndex == text.GetLength();
+		const Utf32Char character = endOfText ? '\n' : text[charIndex];
+		if (character == '\n')
+		{
+			// Align the finished line
+			const Float lineWidth = pen.x;
+			const Float alignOffset = align == OSPLINEDATALABEL_ALIGN_CENTER ? -lineWidth * 0.5 : (align == OSPLINEDATALABEL_ALIGN_RIGHT ? -lineWidth : 0.0);
+			for (Int glyphIndex = lineStart; glyphIndex < _placedGlyphs.GetCount(); ++glyphIndex)
+				_placedGlyphs[glyphIndex].offset.x += alignOffset;
+
+			lineStart = _placedGlyphs.GetCount();
+			pen.x = 0.0;
+			pen.y -= height * SplineDataVisualizationHelpers::LABEL_LINE_SPACING;
+			continue;
+		}
+
+		iferr (const SplineDataVisualizationHelpers::SplineDataGlyph *glyph = SplineDataVisualizationHelpers::g_glyphCache.GetGlyph(font, character, depthSign))
+		{
+			DiagnosticOutput("Error on building glyph: @", err);
+			return nullptr;
+		}
+
+		if (!glyph->polygons.IsEmpty())
+		{
+			iferr (_placedGlyphs.Append(SplineDataVisualizationHelpers::SplineDataPlacedGlyph{ glyph, pen }))
+			{
+				DiagnosticOutput("Error on placing glyph: @", err);
+				return nullptr;
+			}
+			pointCount += (Int32)glyph->points.GetCount();
+			polygonCount += (Int32)glyph->polygons.GetCount();
+		}
+		pen.x += glyph->advance * height;
+	}
+
+	// Alloc a PolygonObject for all glyphs and check it.
+	PolygonObject* polyObjPtr = PolygonObject::Alloc(pointCount, polygonCount);
+	if (!polyObjPtr)
+		return nullptr;
+
+	// Copy the glyphs' meshes to their positions, scaled to the text height and depth
+	Vector* polyPntsPtr = polyObjPtr->GetPointW();
+	CPolygon* polyPolysPtr = polyObjPtr->GetPolygonW();
+	if ((pointCount > 0 && !polyPntsPtr) || (polygonCount > 0 && !polyPolysPtr))
+	{
+		PolygonObject::Free(polyObjPtr);
+		return nullptr;
+	}
+
+	const Vector glyphScale(height, height, Abs(depth));
+	Int32 pointOffset = 0;
+	Int32 polygonOffset = 0;
+	for (const SplineDataVisualizationHelpers::SplineDataPlacedGlyph &placedGlyph : _placedGlyphs)
+	{
+		const SplineDataVisualizationHelpers::SplineDataGlyph &glyph = *placedGlyph.glyph;
+		for (Int pointIndex = 0; pointIndex < glyph.points.GetCount(); ++pointIndex)
+			polyPntsPtr[pointOffset + pointIndex] = glyph.points[pointIndex] * glyphScale + placedGlyph.offset;
+		for (Int polygonIndex = 0; polygonIndex < glyph.polygons.GetCount(); ++polygonIndex)
+		{
+			const CPolygon &polygon = glyph.polygons[polygonIndex];
+			polyPolysPtr[polygonOffset + polygonIndex] = CPolygon(polygon.a + pointOffset, polygon.b + pointOffset, polygon.c + pointOffset, polygon.d + pointOffset);
+		}
+		pointOffset += (Int32)glyph.points.GetCount();
+		polygonOffset += (Int32)glyph.polygons.GetCount();
+	}
+
+	polyObjPtr->SetName(op->GetName());
+	polyObjPtr->Message(MSG_UPDATE);
+
+	return polyObjPtr;
+}
+
+Bool RegisterSplineDataLabel()
+{
+	String registeredName = GeLoadString(IDS_OBJECTDATA_SPLINEDATALABEL);
+	if (!registeredName.IsPopulated())
+		return false;
+
+	return RegisterObjectPlugin(SplineDataVisualizationHelpers::ID_OBJECTDATA_SPLINEDATALABEL, registeredName, OBJECT_GENERATOR, SplineDataLabelObject::Alloc, "osplinedatalabel"_s, AutoBitmap("osplinedataspline.tif"_s), 0);
+}
+
+void FreeSplineDataLabelGlyphCache()
+{
+	SplineDataVisualizationHelpers::g_glyphCache.Free();
+}
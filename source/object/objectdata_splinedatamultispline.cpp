@@ -0,0 +1,330 @@
+// Includes from API
+#include "c4d_baseobject.h"
+#include "c4d_includes.h"
+#include "c4d_objectdata.h"
+#include "maxon/parallelfor.h"
+
+// Includes from plugin project
+#include "c4d_symbols.h"
+#include "main.h"
+
+// Local resources
+#include "osplinedatamultispline.h"
+#include "c4d_resource.h"
+
+// Common values
+#include "commons.h"
+#include "sampling.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// Struct to hold spline generation parameters
+	//----------------------------------------------------------------------------------------
+	struct SplineDataMultiSplineParameters
+	{
+		Float amplitude;
+		Float width;
+		UInt32 samples;
+		Int32 seriesCount;
+		const SplineDataSampleCache *seriesSamples;
+
+		Bool closed;
+		SPLINETYPE splineType;
+		Int32 splineInterpolation;
+		Int32 splineSubdivision;
+		Float splineSubAngle;
+		Float splineSubMaxLength;
+
+		/// \brief Default constructor
+		SplineDataMultiSplineParameters() : amplitude(0.0), width(0.0), samples(0), seriesCount(0), seriesSamples(nullptr),
+			closed(false), splineType(SPLINETYPE::LINEAR),
+			splineInterpolation(SPLINEOBJECT_INTERPOLATION_NONE),
+			splineSubdivision(0), splineSubAngle(0.0),
+			splineSubMaxLength(0.0)
+		{
+		}
+
+		/// \brief Contruct from values
+		SplineDataMultiSplineParameters(Float _amplitude,
+																		Float _width,
+																		UInt32 _samples,
+																		Int32 _seriesCount,
+																		const SplineDataSampleCache *_seriesSamples,
+																		Bool _closed,
+																		SPLINETYPE _splineType,
+																		Int32 _splineInterpolation,
+																		Int32 _splineSubdivision,
+																		Float _splineSubAngle,
+																		Float _splineSubMaxLength) :
+			amplitude(_amplitude), width(_width),
+			samples(_samples), seriesCount(_seriesCount),
+			seriesSamples(_seriesSamples),
+			closed(_closed), splineType(_splineType),
+			splineInterpolation(_splineInterpolation),
+			splineSubdivision(_splineSubdivision),
+			splineSubAngle(_splineSubAngle),
+			splineSubMaxLength(_splineSubMaxLength)
+		{
+		}
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Global function responsible to create the spline points.
+	/// Each series becomes one segment of the spline, all segments share the same point array.
+	/// @brief Global function responsible to create the spline points.
+	/// @param[out] splineObj					SplineObject that will receive the resulting points
+	/// @param[in] params							Parameter set for spline generation
+	/// @return												True if creation process succeeds
+	//----------------------------------------------------------------------------------------
+	static maxon::Result<void> CreateSplineDataMultiSpline(SplineObject& splineObj, SplineDataMultiSplineParameters &params)
+	{
+		iferr_scope;
+
+		if (!params.seriesSamples || params.samples == 0 || params.seriesCount <= 0)
+			return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+		if (splineObj.GetPointCount() != (Int32)params.samples * params.seriesCount)
+			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
+
+		// Set the closed/open status of the SplineObject instance accessing its BaseContainer instance
+		BaseContainer* splineObjBCPtr = splineObj.GetDataInstance();
+		if (splineObjBCPtr)
+		{
+			splineObjBCPtr->SetBool(SPLINEOBJECT_CLOSED, params.closed);
+			splineObjBCPtr->SetInt32(SPLINEOBJECT_INTERPOLATION, params.splineInterpolation);
+			splineObjBCPtr->SetInt32(SPLINEOBJECT_SUB, params.splineSubdivision);
+			splineObjBCPtr->SetFloat(SPLINEOBJECT_ANGLE, params.splineSubAngle);
+			splineObjBCPtr->SetFloat(SPLINEOBJECT_MAXIMUMLENGTH, params.splineSubMaxLength);
+		}
+
+		// Set the number of segments, one per series
+		if (!splineObj.MakeVariableTag(Tsegment, params.seriesCount))
+			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
+
+		// Access the writable array of the points representing the curve passing points
+		Vector* splinePntsPtr = splineObj.GetPointW();
+		if (nullptr == splinePntsPtr)
+			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
+
+		// Access the curve's segments array.
+		Segment* splineSegsPtr = splineObj.GetSegmentW();
+		if (nullptr == splineSegsPtr)
+			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
+
+		// Fill each series' range of the point array
+		const Float xStep = params.width / ((Float)params.samples - 1);
+		for (Int32 seriesIndex = 0; seriesIndex < params.seriesCount; ++seriesIndex)
+		{
+			const SplineDataSampleCache &cache = params.seriesSamples[seriesIndex];
+			if (cache.GetCount() != (Int)params.samples)
+				return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
+
+			const Float32 *values = cache.GetValues();
+			Vector *seriesPntsPtr = splinePntsPtr + seriesIndex * (Int)params.samples;
+			for (Int32 pointIndex = 0; pointIndex < (Int32)params.samples; ++pointIndex)
+				seriesPntsPtr[pointIndex] = Vector((Float)pointIndex * xStep, values[pointIndex] * params.amplitude, 0.0);
+		}
+
+		// Set the closure status and the number of CVs for each segment
+		for (Int32 seriesIndex = 0; seriesIndex < params.seriesCount; ++seriesIndex)
+		{
+			splineSegsPtr[seriesIndex].closed = params.closed;
+			splineSegsPtr[seriesIndex].cnt = params.samples;
+		}
+
+		return maxon::OK;
+	}
+}
+
+
+//------------------------------------------------------------------------------------------------
+/// ObjectData implementation generating one spline segment per SplineData series
+//------------------------------------------------------------------------------------------------
+class SplineDataMultiSplineObject : public ObjectData
+{
+	INSTANCEOF(SplineDataMultiSplineObject, ObjectData)
+
+public:
+	virtual Bool Init(GeListNode* node);
+	virtual void GetDimension(BaseObject* op, Vector* mp, Vector* rad);
+	virtual SplineObject* GetContour(BaseObject* op, BaseDocument* doc, Float lod, BaseThread* bt);
+	Bool GetDEnabling(GeListNode *node, const DescID &id, const GeData &t_data, DESCFLAGS_ENABLE flags, const BaseContainer *itemdesc);
+
+	static NodeData* Alloc()
+	{
+		return NewObj(SplineDataMultiSplineObject) iferr_ignore("SplineDataMultiSplineObject plugin not instanced");
+	}
+
+private:
+	SplineDataVisualizationHelpers::SplineDataSampleCache _sampleCaches[SplineDataVisualizationHelpers::MULTISPLINE_MAX_SERIES]; ///< Samples of each series' curve
+};
+
+Bool SplineDataMultiSplineObject::Init(GeListNode* node)
+{
+	if (!node)
+		return false;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseObject*		 baseObjectPtr = static_cast<BaseObject*>(node);
+	BaseContainer* objectDataPtr = baseObjectPtr->GetDataInstance();
+
+	// Fill object container with initial values
+	objectDataPtr->SetFloat(OSPLINEDATAMULTI_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
+	objectDataPtr->SetFloat(OSPLINEDATAMULTI_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
+	objectDataPtr->SetUInt32(OSPLINEDATAMULTI_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION);
+	objectDataPtr->SetInt32(OSPLINEDATAMULTI_SERIES_COUNT, SplineDataVisualizationHelpers::DEFAULT_MULTISPLINE_SERIES);
+
+	GeData geSplineData(CUSTOMDATATYPE_SPLINE, DEFAULTVALUE);
+	SplineData *splineData = (SplineData*)geSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
+	splineData->MakeLinearSplineBezier(2);
+	for (Int32 seriesIndex = 0; seriesIndex < SplineDataVisualizationHelpers::MULTISPLINE_MAX_SERIES; ++seriesIndex)
+		objectDataPtr->SetData(OSPLINEDATAMULTI_SPLINECURVE_0 + seriesIndex, geSplineData);
+
+	// SplineObject standard parameters
+	objectDataPtr->SetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_CUBIC);
+	objectDataPtr->SetBool(SPLINEOBJECT_CLOSED, false);
+	objectDataPtr->SetInt32(SPLINEOBJECT_INTERPOLATION, SPLINEOBJECT_INTERPOLATION_NATURAL);
+	objectDataPtr->SetInt32(SPLINEOBJECT_SUB, 8);
+	objectDataPtr->SetFloat(SPLINEOBJECT_ANGLE, DegToRad(5.0));
+	objectDataPtr->SetFloat(SPLINEOBJECT_MAXIMUMLENGTH, 5.0);
+
+	return true;
+}
+
+void SplineDataMultiSplineObject::GetDimension(BaseObject *op, Vector *mp, Vector *rad)
+{
+	// Check the passed pointers.
+	if (!op || ! mp || !rad)
+		return;
+
+	// Reset the barycenter position and the bbox radius vector.
+	mp->SetZero();
+	rad->SetZero();
+
+	// Set the barycenter position to match the generator center.
+	const Vector objGlobalOffset = op->GetMg().off;
+	mp->x = objGlobalOffset.x;
+	mp->y = objGlobalOffset.y;
+	mp->z = objGlobalOffset.z;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = op->GetDataInstance();
+	if (!objectDataPtr)
+		return;
+
+	// Set radius values accordingly to the bbox values stored during the init.
+	rad->x = objectDataPtr->GetFloat(OSPLINEDATAMULTI_WIDTH);
+	rad->y = objectDataPtr->GetFloat(OSPLINEDATAMULTI_HEIGHT);
+}
+
+SplineObject* SplineDataMultiSplineObject::GetContour(BaseObject *op, BaseDocument *doc, Float lod, BaseThread *bt)
+{
+	// Check the passed pointer.
+	if (!op)
+		return nullptr;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = op->GetDataInstance();
+
+	// Fill the retrieve BaseContainer object with initial values.
+	const Float width = objectDataPtr->GetFloat(OSPLINEDATAMULTI_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
+	const Float amplitude = objectDataPtr->GetFloat(OSPLINEDATAMULTI_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
+	const UInt32 samples = objectDataPtr->GetUInt32(OSPLINEDATAMULTI_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION) + 1;
+	const Int32 seriesCount = ClampValue(objectDataPtr->GetInt32(OSPLINEDATAMULTI_SERIES_COUNT, SplineDataVisualizationHelpers::DEFAULT_MULTISPLINE_SERIES), (Int32)1, SplineDataVisualizationHelpers::MULTISPLINE_MAX_SERIES);
+
+	// Collect the curves of all active series
+	GeData geSplineData[SplineDataVisualizationHelpers::MULTISPLINE_MAX_SERIES];
+	SplineData *splineData[SplineDataVisualizationHelpers::MULTISPLINE_MAX_SERIES];
+	for (Int32 seriesIndex = 0; seriesIndex < seriesCount; ++seriesIndex)
+	{
+		geSplineData[seriesIndex] = objectDataPtr->GetData(OSPLINEDATAMULTI_SPLINECURVE_0 + seriesIndex);
+		splineData[seriesIndex] = (SplineData*)geSplineData[seriesIndex].GetCustomDataType(CUSTOMDATATYPE_SPLINE);
+		if (!splineData[seriesIndex])
+			return nullptr;
+	}
+
+	// Sample all series in parallel, each series evaluates its own curve. Caches of unchanged curves are reused.
+	iferr (maxon::ParallelFor::Dynamic(0, seriesCount,
+		[this, &splineData, samples](Int seriesIndex) -> maxon::Result<void>
+		{
+			iferr_scope;
+			_sampleCaches[seriesIndex].Update(splineData[seriesIndex], samples) iferr_return;
+			return maxon::OK;
+		}))
+	{
+		DiagnosticOutput("Error on sampling SplineData series: @", err);
+		return nullptr;
+	}
+
+	// Release caches of series that are no longer in use
+	for (Int32 seriesIndex = seriesCount; seriesIndex < SplineDataVisualizationHelpers::MULTISPLINE_MAX_SERIES; ++seriesIndex)
+		_sampleCaches[seriesIndex].Reset();
+
+	const Bool closed = objectDataPtr->GetBool(SPLINEOBJECT_CLOSED, false);
+	const SPLINETYPE splineType = (SPLINETYPE)objectDataPtr->GetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_LINEAR);
+	const Int32 splineInterpolation = objectDataPtr->GetInt32(SPLINEOBJECT_INTERPOLATION, SPLINEOBJECT_INTERPOLATION_NONE);
+	const Int32 splineSubdivision = objectDataPtr->GetInt32(SPLINEOBJECT_SUB, 0);
+	const Float splineAngle = objectDataPtr->GetFloat(SPLINEOBJECT_ANGLE, 0.0);
+	const Float splineMaxLength = objectDataPtr->GetFloat(SPLINEOBJECT_MAXIMUMLENGTH, 0.0);
+
+	// Set parameters to params set
+	SplineDataVisualizationHelpers::SplineDataMultiSplineParameters params(amplitude, width, samples, seriesCount, _sampleCaches, closed, splineType, splineInterpolation, splineSubdivision, splineAngle, splineMaxLength);
+
+	// Alloc a SplineObject holding the points of all series, and check it.
+	SplineObject* splineObjPtr = SplineObject::Alloc((Int32)params.samples * params.seriesCount, params.splineType);
+	if (!splineObjPtr)
+		return nullptr;
+
+	// Invoke the helper function to set the SplineObject object member accordingly
+	iferr (SplineDataVisualizationHelpers::CreateSplineDataMultiSpline(*splineObjPtr, params))
+	{
+		DiagnosticOutput("Error on CreateSplineDataMultiSpline: @", err);
+		SplineObject::Free(splineObjPtr);
+		return nullptr;
+	}
+
+	splineObjPtr->Message(MSG_UPDATE);
+
+	return splineObjPtr;
+}
+
+Bool SplineDataMultiSplineObject::GetDEnabling(GeListNode *node, const DescID &id, const GeData &t_data, DESCFLAGS_ENABLE flags, const BaseContainer *itemdesc)
+{
+	// Check the passed pointer.
+	if (!node)
+		return false;
+
+	// Retrieve the BaseContainer object belonging to the generator.
+	BaseContainer* objectDataPtr = static_cast<BaseObject*>(node)->GetDataInstance();
+	if (!objectDataPtr)
+		return false;
+
+	// Series curves beyond the series count are not used
+	const Int32 paramId = id[0].id;
+	if (paramId >= OSPLINEDATAMULTI_SPLINECURVE_0 && paramId <= OSPLINEDATAMULTI_SPLINECURVE_9)
+		return paramId - OSPLINEDATAMULTI_SPLINECURVE_0 < objectDataPtr->GetInt32(OSPLINEDATAMULTI_SERIES_COUNT);
+
+	Int32 interpolation = objectDataPtr->GetInt32(SPLINEOBJECT_INTERPOLATION);
+	switch (paramId)
+	{
+		case SPLINEOBJECT_ANGLE:
+			return interpolation == SPLINEOBJECT_INTERPOLATION_ADAPTIVE || interpolation == SPLINEOBJECT_INTERPOLATION_SUBDIV;
+		case SPLINEOBJECT_MAXIMUMLENGTH:
+			return interpolation == SPLINEOBJECT_INTERPOLATION_SUBDIV;
+		case SPLINEOBJECT_SUB:
+			return interpolation == SPLINEOBJECT_INTERPOLATION_NATURAL || interpolation == SPLINEOBJECT_INTERPOLATION_UNIFORM;
+	}
+
+	return SUPER::GetDEnabling(node, id, t_data, flags, itemdesc);
+}
+
+
+Bool RegisterSplineDataMultiSpline()
+{
+	String registeredName = GeLoadString(IDS_OBJECTDATA_SPLINEDATAMULTISPLINE);
+	if (!registeredName.IsPopulated())
+		return false;
+
+	return RegisterObjectPlugin(SplineDataVisualizationHelpers::ID_OBJECTDATA_SPLINEDATAMULTISPLINE, registeredName, OBJECT_GENERATOR|OBJECT_ISSPLINE, SplineDataMultiSplineObject::Alloc, "osplinedatamultispline"_s, AutoBitmap("osplinedataspline.tif"_s), 0);
+}
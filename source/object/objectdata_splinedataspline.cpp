@@ -13,6 +13,11 @@
 
 // Common values
 #include "commons.h"
+#include "sampling.h"
+#include "persistedcontour.h"
+#include "regenerationjob.h"
+#include "core/curvelayout.h"
+#include "core/polarlayout.h"
 
 
 namespace SplineDataVisualizationHelpers
@@ -25,7 +30,15 @@ namespace SplineDataVisualizationHelpers
 		Float amplitude;
 		Float width;
 		UInt32 samples;
-		SplineData *splineData;
+		const Float32 *values;
+		const Float32 *targetValues;
+		Float blend;
+		ScaleMapping scale;
+		Bool derivative;
+		Bool integral;
+		Float derivativeScale;
+		Float integralScale;
+		Float sampleSpacing;
 
 		Bool closed;
 		SPLINETYPE splineType;
@@ -35,7 +48,10 @@ namespace SplineDataVisualizationHelpers
 		Float splineSubMaxLength;
 
 		/// \brief Default constructor
-		SplineDataSplineParameters() : amplitude(0.0), width(0.0), samples(0), splineData(nullptr),
+		SplineDataSplineParameters() : amplitude(0.0), width(0.0), samples(0), values(nullptr),
+			targetValues(nullptr), blend(0.0), scale(),
+			derivative(false), integral(false), derivativeScale(0.0),
+			integralScale(0.0), sampleSpacing(0.0),
 			closed(false), splineType(SPLINETYPE::LINEAR),
 			splineInterpolation(SPLINEOBJECT_INTERPOLATION_NONE),
 			splineSubdivision(0), splineSubAngle(0.0),
@@ -47,7 +63,15 @@ namespace SplineDataVisualizationHelpers
 		SplineDataSplineParameters(Float _amplitude,
 															 Float _width,
 															 UInt32 _samples,
-															 SplineData *_splineData,
+															 const Float32 *_values,
+															 const Float32 *_targetValues,
+															 Float _blend,
+															 const ScaleMapping &_scale,
+															 Bool _derivative,
+															 Bool _integral,
+															 Float _derivativeScale,
+															 Float _integralScale,
+															 Float _sampleSpacing,
 															 Bool _closed,
 															 SPLINETYPE _splineType,
 															 Int32 _splineInterpolation,
@@ -55,7 +79,11 @@ namespace SplineDataVisualizationHelpers
 															 Float _splineSubAngle,
 															 Float _splineSubMaxLength) :
 			amplitude(_amplitude), width(_width),
-			samples(_samples), splineData(_splineData),
+			samples(_samples), values(_values),
+			targetValues(_targetValues), blend(_blend), scale(_scale),
+			derivative(_derivative), integral(_integral),
+			derivativeScale(_derivativeScale), integralScale(_integralScale),
+			sampleSpacing(_sampleSpacing),
 			closed(_closed), splineType(_splineType),
 			splineInterpolation(_splineInterpolation),
 			splineSubdivision(_splineSubdivision),
@@ -63,20 +91,29 @@ namespace SplineDataVisualizationHelpers
 			splineSubMaxLength(_splineSubMaxLength)
 		{
 		}
+
+		/// \brief Returns the number of segments: the curve, and optionally its derivative and integral
+		Int32 GetSegmentCount() const
+		{
+			return 1 + (derivative ? 1 : 0) + (integral ? 1 : 0);
+		}
 	};
 
 	//----------------------------------------------------------------------------------------
 	/// Global function responsible to create the spline points.
+	/// The curve is the first segment, the derivative and integral overlays follow as separate segments.
 	/// @brief Global function responsible to create the spline points.
 	/// @param[out] splineObj					SplineObject that will receive the resulting points
 	/// @param[in] params							Parameter set for spline generation
+	/// @param[in] contourValues			Stored y values of a previous contour, used instead of params.values if not nullptr
 	/// @return												True if creation process succeeds
 	//----------------------------------------------------------------------------------------
-	static maxon::Result<void> CreateSplineDataSpline(SplineObject& splineObj, SplineDataSplineParameters &params)
+	static maxon::Result<void> CreateSplineDataSpline(SplineObject& splineObj, SplineDataSplineParameters &params, const Float32 *contourValues = nullptr)
 	{
-		if (!params.splineData || params.samples == 0)
+		if ((!params.values && !contourValues) || params.samples == 0)
 			return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
-		if (splineObj.GetPointCount() != (Int32)params.samples)
+		const Int32 segmentCount = params.GetSegmentCount();
+		if (splineObj.GetPointCount() != (Int32)params.samples * segmentCount)
 			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
 
 		// Set the closed/open status of the SplineObject instance accessing its BaseContainer instance
@@ -91,7 +128,6 @@ namespace SplineDataVisualizationHelpers
 		}
 
 		// Set the number of segments
-		const Int32 segmentCount = 1;
 		if (!splineObj.MakeVariableTag(Tsegment, segmentCount))
 			return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
 
@@ -100,12 +136,33 @@ namespace SplineDataVisualizationHelpers
 		if (nullptr == splinePntsPtr)
 			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
 
-		// Sample splineData, set point positions
-		for (Int32 pointIndex = 0; pointIndex < (Int32)params.samples; ++pointIndex)
+		const Float xStep = params.width / ((Float)params.samples - 1);
+		if (contourValues)
+		{
+			// Restore point positions from a stored contour, the values are already mapped and blended
+			const Int32 pointCount = (Int32)params.samples * segmentCount;
+			for (Int32 pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+				splinePntsPtr[pointIndex] = Vector((Float)(pointIndex % (Int32)params.samples) * xStep, (Float)contourValues[pointIndex], 0.0);
+		}
+		else
 		{
-			Float samplePos = (Float)pointIndex / ((Float)params.samples - 1);
-			Float splineValue = params.splineData->GetPoint(samplePos).y;
-			splinePntsPtr[pointIndex] = Vector(samplePos * params.width, splineValue * params.amplitude, 0.0);
+			// Set point positions from the pre-sampled values. The scale transform is chosen once
+			// per curve, not per point.
+			// Overlays are computed from the same samples, in the same loop as the curve.
+			SplineDataCurveOverlays<Vector> overlays;
+			Vector *overlayPntsPtr = splinePntsPtr + params.samples;
+			if (params.derivative)
+			{
+				overlays.derivativePoints = overlayPntsPtr;
+				overlayPntsPtr += params.samples;
+			}
+			if (params.integral)
+				overlays.integralPoints = overlayPntsPtr;
+			overlays.sampleSpacing = params.sampleSpacing;
+			overlays.derivativeHeight = params.amplitude * params.derivativeScale;
+			overlays.integralHeight = params.amplitude * params.integralScale;
+
+			WriteSplineDataCurvePoints(splinePntsPtr, overlays, params.values, params.targetValues, params.blend, params.samples, 0.0, xStep, params.scale);
 		}
 
 		// Access the curve's segments array.
@@ -113,34 +170,221 @@ namespace SplineDataVisualizationHelpers
 		if (nullptr == splineSegsPtr)
 			return maxon::NullptrError(MAXON_SOURCE_LOCATION);
 
-		// Set the closure status and the number of CVs for the only one segment existing.
-		splineSegsPtr[0].closed = params.closed;
-		splineSegsPtr[0].cnt = params.samples;
+		// Set the closure status and the number of CVs for the curve, overlays are always open
+		for (Int32 segmentIndex = 0; segmentIndex < segmentCount; ++segmentIndex)
+		{
+			splineSegsPtr[segmentIndex].closed = segmentIndex == 0 ? params.closed : false;
+			splineSegsPtr[segmentIndex].cnt = params.samples;
+		}
 
 		return maxon::OK;
 	}
+
+	//----------------------------------------------------------------------------------------
+	/// Computes the derivative of the mapped (and blended) curve value at each sample, with
+	/// respect to the sample index. The slopes of the samples are blended like the values,
+	/// and mapped to the chart height with the chain rule.
+	/// @brief Computes the derivative of the mapped curve value at each sample.
+	/// @param[out] derivatives				Array receiving one value per sample
+	/// @param[in] samples						Number of samples
+	/// @param[in] scale							Mapping from values to the chart height
+	/// @param[in] values							The samples of the curve
+	/// @param[in] slopes							The slopes of the curve at its samples
+	/// @param[in] targetValues				The samples of the morph target curve, or nullptr if morph mode is off
+	/// @param[in] targetSlopes				The slopes of the morph target curve at its samples, or nullptr if morph mode is off
+	/// @param[in] blend							Blend factor towards the morph target (0.0 - 1.0)
+	/// @param[in] sampleSpacing			Distance between two samples along the curve
+	//----------------------------------------------------------------------------------------
+	static void ComputeSplineDataSampleDerivatives(Float *derivatives, UInt32 samples, const ScaleMapping &scale, const Float32 *values, const Float32 *slopes, const Float32 *targetValues, const Float32 *targetSlopes, Float blend, Float sampleSpacing)
+	{
+		for (UInt32 sampleIndex = 0; sampleIndex < samples; ++sampleIndex)
+		{
+			Float value = values[sampleIndex];
+			Float slope = slopes[sampleIndex];
+			if (targetValues)
+			{
+				value += ((Float)targetValues[sampleIndex] - value) * blend;
+				slope += ((Float)targetSlopes[sampleIndex] - slope) * blend;
+			}
+			derivatives[sampleIndex] = scale.MapDerivative(value) * slope * sampleSpacing;
+		}
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Computes a hash over all parameters that affect the y values of the contour.
+	/// @brief Computes a hash over all parameters that affect the y values of the contour.
+	/// @param[in] objectData					The generator's BaseContainer
+	/// @param[in] samples						Number of samples
+	/// @param[in] splineData					The SplineData curve
+	/// @param[in] targetSplineData		The morph target curve, or nullptr if morph mode is off
+	/// @return												Hash value
+	//----------------------------------------------------------------------------------------
+	static UInt64 GetContourParameterHash(const BaseContainer &objectData, UInt32 samples, SplineData *splineData, SplineData *targetSplineData)
+	{
+		UInt64 hash = GetSplineDataHash(splineData);
+		HashCombine(hash, samples);
+		HashCombine(hash, objectData.GetFloat(OSPLINEDATA_HEIGHT));
+		HashCombine(hash, objectData.GetFloat(OSPLINEDATA_RANGE_START));
+		HashCombine(hash, objectData.GetFloat(OSPLINEDATA_RANGE_END));
+		HashCombine(hash, objectData.GetInt32(OSPLINEDATA_SCALE));
+		HashCombine(hash, objectData.GetFloat(OSPLINEDATA_SCALE_MIN));
+		HashCombine(hash, objectData.GetFloat(OSPLINEDATA_SCALE_MAX));
+		HashCombine(hash, objectData.GetBool(OSPLINEDATA_DERIVATIVE));
+		HashCombine(hash, objectData.GetFloat(OSPLINEDATA_DERIVATIVE_SCALE));
+		HashCombine(hash, objectData.GetBool(OSPLINEDATA_INTEGRAL));
+		HashCombine(hash, objectData.GetFloat(OSPLINEDATA_INTEGRAL_SCALE));
+		HashCombine(hash, objectData.GetBool(OSPLINEDATA_TANGENTS));
+		if (targetSplineData)
+		{
+			HashCombine(hash, GetSplineDataHash(targetSplineData));
+			HashCombine(hash, objectData.GetFloat(OSPLINEDATA_MORPH_BLEND));
+		}
+		return hash;
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Cosine and sine of the sample angles of the polar layout. They only depend on the
+	/// number of samples and the angles, so the table is only rebuilt when one of them changes.
+	//----------------------------------------------------------------------------------------
+	class SplineDataPolarTable
+	{
+	public:
+		//----------------------------------------------------------------------------------------
+		/// Rebuilds the table if necessary.
+		/// @brief Rebuilds the table if necessary.
+		/// @param[in] samples						Number of samples
+		/// @param[in] startAngle					Angle of the first sample in radians
+		/// @param[in] sweepAngle					Angle between the first and the last sample in radians
+		/// @return												OK on success
+		//----------------------------------------------------------------------------------------
+		maxon::Result<void> Update(UInt32 samples, Float startAngle, Float sweepAngle)
+		{
+			iferr_scope;
+
+			if (samples == _samples && startAngle == _startAngle && sweepAngle == _sweepAngle)
+				return maxon::OK;
+
+			_samples = 0;
+			_cosValues.Resize(samples) iferr_return;
+			_sinValues.Resize(samples) iferr_return;
+			FillPolarAngleTable(_cosValues.GetFirst(), _sinValues.GetFirst(), samples, startAngle, sweepAngle);
+
+			_samples = samples;
+			_startAngle = startAngle;
+			_sweepAngle = sweepAngle;
+			return maxon::OK;
+		}
+
+		/// \brief Discards the table
+		void Reset()
+		{
+			_cosValues.Reset();
+			_sinValues.Reset();
+			_samples = 0;
+		}
+
+		/// \brief Returns the cosine values
+		const Float *GetCosValues() const
+		{
+			return _cosValues.GetFirst();
+		}
+
+		/// \brief Returns the sine values
+		const Float *GetSinValues() const
+		{
+			return _sinValues.GetFirst();
+		}
+
+	private:
+		maxon::BaseArray<Float> _cosValues;
+		maxon::BaseArray<Float> _sinValues;
+		UInt32 _samples = 0;
+		Float _startAngle = 0.0;
+		Float _sweepAngle = 0.0;
+	};
 }
 
 
 //------------------------------------------------------------------------------------------------
 /// ObjectData implementation generating a spline based on a SplineData
 //------------------------------------------------------------------------------------------------
-class SplineDataSplineObject : public ObjectData
+class SplineDataSplineObject : public ObjectData, public SplineDataVisualizationHelpers::SplineDataRegenerationJob
 {
 	INSTANCEOF(SplineDataSplineObject, ObjectData)
 
 public:
 	virtual Bool Init(GeListNode* node);
 	virtual void GetDimension(BaseObject* op, Vector* mp, Vector* rad);
+	virtual void CheckDirty(BaseObject* op, BaseDocument* doc);
 	virtual SplineObject* GetContour(BaseObject* op, BaseDocument* doc, Float lod, BaseThread* bt);
+	virtual SplineObject* BuildContour(BaseObject& op, BaseThread* bt);
+	virtual Bool Message(GeListNode* node, Int32 type, void* data);
 	Bool GetDEnabling(GeListNode *node, const DescID &id, const GeData &t_data, DESCFLAGS_ENABLE flags, const BaseContainer *itemdesc);
+	virtual Bool Read(GeListNode* node, HyperFile* hf, Int32 level);
+	virtual Bool Write(GeListNode* node, HyperFile* hf);
+	virtual Bool CopyTo(NodeData* dest, GeListNode* snode, GeListNode* dnode, COPYFLAGS flags, AliasTrans* trn);
 
 	static NodeData* Alloc()
 	{
 		return NewObj(SplineDataSplineObject) iferr_ignore("SplineDataSplineObject plugin not instanced");
 	}
+
+private:
+	//----------------------------------------------------------------------------------------
+	/// Returns the samples of the visible range of a curve, served from its sample pyramid.
+	/// @brief Returns the samples of the visible range of a curve.
+	/// @param[in] pyramid						The curve's sample pyramid, updated if the curve has changed
+	/// @param[in] rangeValues				Buffer for the samples, if the range does not cover the whole curve
+	/// @param[in] rangeSlopes				Buffer for the slopes of the samples, if the range does not cover the whole curve
+	/// @param[in] splineData					The curve
+	/// @param[in] samples						Number of samples
+	/// @param[in] xStart							Start of the visible range (0.0 - 1.0)
+	/// @param[in] xEnd								End of the visible range (0.0 - 1.0)
+	/// @param[in] budget							Time budget for evaluating the curve
+	/// @param[out] slopes						Receives the pointer to the slopes of the samples, or nullptr if no slopes are needed
+	/// @return												Pointer to the sample values
+	//----------------------------------------------------------------------------------------
+	maxon::Result<const Float32*> SampleVisibleRange(SplineDataVisualizationHelpers::SplineDataSamplePyramid &pyramid, maxon::BaseArray<Float32> &rangeValues, maxon::BaseArray<Float32> &rangeSlopes, SplineData *splineData, UInt32 samples, Float xStart, Float xEnd, const SplineDataVisualizationHelpers::SplineDataSamplingBudget &budget, const Float32 **slopes);
+
+	SplineDataVisualizationHelpers::SplineDataSamplePyramid _samplePyramid;       ///< Sample pyramid of the SplineData curve
+	SplineDataVisualizationHelpers::SplineDataSamplePyramid _targetSamplePyramid; ///< Sample pyramid of the morph target curve
+	maxon::BaseArray<Float32> _rangeValues;                                       ///< Samples of the visible range of the SplineData curve
+	maxon::BaseArray<Float32> _rangeSlopes;                                       ///< Slopes of the samples of the visible range of the SplineData curve
+	maxon::BaseArray<Float32> _targetRangeValues;                                 ///< Samples of the visible range of the morph target curve
+	maxon::BaseArray<Float32> _targetRangeSlopes;                                 ///< Slopes of the samples of the visible range of the morph target curve
+	SplineDataVisualizationHelpers::SplineDataPersistedContour _persistedContour;  ///< Last generated contour, stored in the document
+	SplineDataVisualizationHelpers::SplineDataPolarTable _polarTable;              ///< Sample angles of the polar layout
+	maxon::BaseArray<Float> _sampleDerivatives;                                    ///< Derivatives of the curve for the curve tangents
 };
 
+maxon::Result<const Float32*> SplineDataSplineObject::SampleVisibleRange(SplineDataVisualizationHelpers::SplineDataSamplePyramid &pyramid, maxon::BaseArray<Float32> &rangeValues, maxon::BaseArray<Float32> &rangeSlopes, SplineData *splineData, UInt32 samples, Float xStart, Float xEnd, const SplineDataVisualizationHelpers::SplineDataSamplingBudget &budget, const Float32 **slopes)
+{
+	iferr_scope;
+
+	pyramid.Update(splineData, samples, budget, slopes != nullptr) iferr_return;
+
+	// The full range is served directly from the base level
+	if (xStart <= 0.0 && xEnd >= 1.0)
+	{
+		if (slopes)
+			*slopes = pyramid.GetBaseSlopes();
+		return pyramid.GetBaseValues();
+	}
+
+	rangeValues.Resize(samples) iferr_return;
+	if (slopes)
+	{
+		rangeSlopes.Resize(samples) iferr_return;
+		*slopes = rangeSlopes.GetFirst();
+	}
+	else
+	{
+		rangeSlopes.Reset();
+	}
+	pyramid.SampleRange(splineData, xStart, xEnd, rangeValues.GetFirst(), slopes ? rangeSlopes.GetFirst() : nullptr, rangeValues.GetCount(), budget) iferr_return;
+	return rangeValues.GetFirst();
+}
+
 Bool SplineDataSplineObject::Init(GeListNode* node)
 {
 	if (!node)
@@ -154,12 +398,35 @@ Bool SplineDataSplineObject::Init(GeListNode* node)
 	objectDataPtr->SetFloat(OSPLINEDATA_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
 	objectDataPtr->SetFloat(OSPLINEDATA_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
 	objectDataPtr->SetUInt32(OSPLINEDATA_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION);
+	objectDataPtr->SetInt32(OSPLINEDATA_TIME_BUDGET, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_TIME_BUDGET);
+	objectDataPtr->SetFloat(OSPLINEDATA_RANGE_START, 0.0);
+	objectDataPtr->SetFloat(OSPLINEDATA_RANGE_END, 1.0);
+	objectDataPtr->SetInt32(OSPLINEDATA_SCALE, OSPLINEDATA_SCALE_LINEAR);
+	objectDataPtr->SetFloat(OSPLINEDATA_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	objectDataPtr->SetFloat(OSPLINEDATA_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
+	objectDataPtr->SetInt32(OSPLINEDATA_LAYOUT, OSPLINEDATA_LAYOUT_CARTESIAN);
+	objectDataPtr->SetFloat(OSPLINEDATA_POLAR_START_ANGLE, 0.0);
+	objectDataPtr->SetFloat(OSPLINEDATA_POLAR_SWEEP, SplineDataVisualizationHelpers::DEFAULT_POLAR_SWEEP);
 
 	GeData geSplineData(CUSTOMDATATYPE_SPLINE, DEFAULTVALUE);
 	SplineData *splineData = (SplineData*)geSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
 	splineData->MakeLinearSplineBezier(2);
 	objectDataPtr->SetData(OSPLINEDATA_SPLINECURVE, geSplineData);
 
+	// Morph mode
+	objectDataPtr->SetBool(OSPLINEDATA_MORPH, false);
+	objectDataPtr->SetData(OSPLINEDATA_MORPH_SPLINECURVE, geSplineData);
+	objectDataPtr->SetFloat(OSPLINEDATA_MORPH_BLEND, 0.0);
+
+	// Overlays
+	objectDataPtr->SetBool(OSPLINEDATA_DERIVATIVE, false);
+	objectDataPtr->SetFloat(OSPLINEDATA_DERIVATIVE_SCALE, SplineDataVisualizationHelpers::DEFAULT_OVERLAY_SCALE);
+	objectDataPtr->SetBool(OSPLINEDATA_INTEGRAL, false);
+	objectDataPtr->SetFloat(OSPLINEDATA_INTEGRAL_SCALE, SplineDataVisualizationHelpers::DEFAULT_OVERLAY_SCALE);
+
+	// Tangents
+	objectDataPtr->SetBool(OSPLINEDATA_TANGENTS, false);
+
 	// SplineObject standard parameters
 	objectDataPtr->SetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_CUBIC);
 	objectDataPtr->SetBool(SPLINEOBJECT_CLOSED, false);
@@ -192,9 +459,19 @@ void SplineDataSplineObject::GetDimension(BaseObject *op, Vector *mp, Vector *ra
 	if (!objectDataPtr)
 		return;
 
-	// Set radius values accordingly to the bbox values stored during the init.
-	rad->x = objectDataPtr->GetFloat(OSPLINEDATA_WIDTH);
+	// Set radius values accordingly to the bbox values stored during the init. In polar layout, Height is the radius.
 	rad->y = objectDataPtr->GetFloat(OSPLINEDATA_HEIGHT);
+	if (objectDataPtr->GetInt32(OSPLINEDATA_LAYOUT) == OSPLINEDATA_LAYOUT_POLAR)
+		rad->x = rad->y;
+	else
+		rad->x = objectDataPtr->GetFloat(OSPLINEDATA_WIDTH);
+}
+
+void SplineDataSplineObject::CheckDirty(BaseObject *op, BaseDocument *doc)
+{
+	// Keep rebuilding the contour until all samples have been evaluated
+	if (op)
+		CheckRefinement(*op);
 }
 
 SplineObject* SplineDataSplineObject::GetContour(BaseObject *op, BaseDocument *doc, Float lod, BaseThread *bt)
@@ -203,41 +480,215 @@ SplineObject* SplineDataSplineObject::GetContour(BaseObject *op, BaseDocument *d
 	if (!op)
 		return nullptr;
 
+	// The contour may already have been built by the regeneration scheduler
+	return TakeContour(*op, bt);
+}
+
+SplineObject* SplineDataSplineObject::BuildContour(BaseObject &op, BaseThread *bt)
+{
 	// Retrieve the BaseContainer object belonging to the generator.
-	BaseContainer* objectDataPtr = op->GetDataInstance();
+	BaseContainer* objectDataPtr = op.GetDataInstance();
+	if (!objectDataPtr)
+		return nullptr;
 
 	// Fill the retrieve BaseContainer object with initial values.
 	const Float width = objectDataPtr->GetFloat(OSPLINEDATA_WIDTH, SplineDataVisualizationHelpers::DEFAULT_WIDTH);
 	const Float amplitude = objectDataPtr->GetFloat(OSPLINEDATA_HEIGHT, SplineDataVisualizationHelpers::DEFAULT_HEIGHT);
 	const UInt32 samples = objectDataPtr->GetUInt32(OSPLINEDATA_SUBDIVISION, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_SUBDIVISION) + 1;
+	const SplineDataVisualizationHelpers::SCALETYPE scaleType = (SplineDataVisualizationHelpers::SCALETYPE)objectDataPtr->GetInt32(OSPLINEDATA_SCALE, OSPLINEDATA_SCALE_LINEAR);
+	const Float scaleMin = objectDataPtr->GetFloat(OSPLINEDATA_SCALE_MIN, SplineDataVisualizationHelpers::DEFAULT_SCALE_MIN);
+	const Float scaleMax = objectDataPtr->GetFloat(OSPLINEDATA_SCALE_MAX, SplineDataVisualizationHelpers::DEFAULT_SCALE_MAX);
+	const SplineDataVisualizationHelpers::ScaleMapping scale(scaleType, scaleMin, scaleMax, amplitude);
 	GeData geSplineData = objectDataPtr->GetData(OSPLINEDATA_SPLINECURVE);
 	SplineData *splineData = (SplineData*)geSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
 	if (!splineData)
 		return nullptr;
 
+	// Visible x range, keep a minimum width to avoid degenerate ranges
+	Float xStart = ClampValue(objectDataPtr->GetFloat(OSPLINEDATA_RANGE_START, 0.0), 0.0, 1.0);
+	Float xEnd = ClampValue(objectDataPtr->GetFloat(OSPLINEDATA_RANGE_END, 1.0), 0.0, 1.0);
+	if (xEnd - xStart < SplineDataVisualizationHelpers::MIN_VISIBLE_RANGE)
+	{
+		xEnd = Min(xStart + SplineDataVisualizationHelpers::MIN_VISIBLE_RANGE, 1.0);
+		xStart = xEnd - SplineDataVisualizationHelpers::MIN_VISIBLE_RANGE;
+	}
+
+	// Morph target curve
+	GeData geTargetSplineData;
+	SplineData *targetSplineData = nullptr;
+	const Float blend = objectDataPtr->GetFloat(OSPLINEDATA_MORPH_BLEND, 0.0);
+	if (objectDataPtr->GetBool(OSPLINEDATA_MORPH, false))
+	{
+		geTargetSplineData = objectDataPtr->GetData(OSPLINEDATA_MORPH_SPLINECURVE);
+		targetSplineData = (SplineData*)geTargetSplineData.GetCustomDataType(CUSTOMDATATYPE_SPLINE);
+		if (!targetSplineData)
+			return nullptr;
+	}
+
+	// Derivative and integral overlays, each adds one segment
+	const Bool derivative = objectDataPtr->GetBool(OSPLINEDATA_DERIVATIVE, false);
+	const Float derivativeScale = objectDataPtr->GetFloat(OSPLINEDATA_DERIVATIVE_SCALE, SplineDataVisualizationHelpers::DEFAULT_OVERLAY_SCALE);
+	const Bool integral = objectDataPtr->GetBool(OSPLINEDATA_INTEGRAL, false);
+	const Float integralScale = objectDataPtr->GetFloat(OSPLINEDATA_INTEGRAL_SCALE, SplineDataVisualizationHelpers::DEFAULT_OVERLAY_SCALE);
+	const Float sampleSpacing = (xEnd - xStart) / ((Float)samples - 1);
+	const Int32 segmentCount = 1 + (derivative ? 1 : 0) + (integral ? 1 : 0);
+
+	// Curve tangents need a Bezier spline and the slopes of the samples, the tangents are ignored by all other types
+	const Bool curveTangents = objectDataPtr->GetBool(OSPLINEDATA_TANGENTS, false);
+
+	// If the stored contour (e.g. loaded with the document) was generated from the same parameters, it is used directly.
+	// With curve tangents, it also holds the derivatives of the curve's points.
+	const UInt64 contourHash = SplineDataVisualizationHelpers::GetContourParameterHash(*objectDataPtr, samples, splineData, targetSplineData);
+	const UInt32 contourPointCount = samples * (UInt32)segmentCount;
+	const Float32 *contourValues = _persistedContour.IsValid(contourHash, contourPointCount + (curveTangents ? samples : 0)) ? _persistedContour.GetValues() : nullptr;
+
+	// In viewport redraws, samples that are not evaluated within the time budget are approximated first,
+	// and refined on later evaluations. Rendering threads sample completely.
+	const SplineDataVisualizationHelpers::SplineDataSamplingBudget budget = SplineDataVisualizationHelpers::GetSplineDataSamplingBudget(bt, (Float)objectDataPtr->GetInt32(OSPLINEDATA_TIME_BUDGET, SplineDataVisualizationHelpers::DEFAULT_SPLINEDATA_TIME_BUDGET));
+
+	const Float32 *values = nullptr;
+	const Float32 *slopes = nullptr;
+	const Float32 *targetValues = nullptr;
+	const Float32 *targetSlopes = nullptr;
+	Bool refinementPending = false;
+	if (!contourValues)
+	{
+		// Get the samples of the visible range. The curve is only re-sampled if it has changed since the last call.
+		iferr (values = SampleVisibleRange(_samplePyramid, _rangeValues, _rangeSlopes, splineData, samples, xStart, xEnd, budget, curveTangents ? &slopes : nullptr))
+		{
+			DiagnosticOutput("Error on sampling SplineData: @", err);
+			return nullptr;
+		}
+
+		// In morph mode, also sample the target curve. Per call, only the blend is computed.
+		if (targetSplineData)
+		{
+			iferr (targetValues = SampleVisibleRange(_targetSamplePyramid, _targetRangeValues, _targetRangeSlopes, targetSplineData, samples, xStart, xEnd, budget, curveTangents ? &targetSlopes : nullptr))
+			{
+				DiagnosticOutput("Error on sampling morph target SplineData: @", err);
+				return nullptr;
+			}
+		}
+		else
+		{
+			_targetSamplePyramid.Reset();
+			_targetRangeValues.Reset();
+			_targetRangeSlopes.Reset();
+		}
+
+		refinementPending = !_samplePyramid.IsComplete() || (targetSplineData && !_targetSamplePyramid.IsComplete());
+		if (refinementPending)
+			SplineDataVisualizationHelpers::RequestSplineDataRefinement();
+	}
+	SetRefinementPending(refinementPending);
+
 	const Bool closed = objectDataPtr->GetBool(SPLINEOBJECT_CLOSED, false);
-	const SPLINETYPE splineType = (SPLINETYPE)objectDataPtr->GetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_LINEAR);
+	const SPLINETYPE splineType = curveTangents ? SPLINETYPE::BEZIER : (SPLINETYPE)objectDataPtr->GetInt32(SPLINEOBJECT_TYPE, SPLINEOBJECT_TYPE_LINEAR);
 	const Int32 splineInterpolation = objectDataPtr->GetInt32(SPLINEOBJECT_INTERPOLATION, SPLINEOBJECT_INTERPOLATION_NONE);
 	const Int32 splineSubdivision = objectDataPtr->GetInt32(SPLINEOBJECT_SUB, 0);
 	const Float splineAngle = objectDataPtr->GetFloat(SPLINEOBJECT_ANGLE, 0.0);
 	const Float splineMaxLength = objectDataPtr->GetFloat(SPLINEOBJECT_MAXIMUMLENGTH, 0.0);
 
 	// Set parameters to params set
-	SplineDataVisualizationHelpers::SplineDataSplineParameters params(amplitude, width, samples, splineData, closed, splineType, splineInterpolation, splineSubdivision, splineAngle, splineMaxLength);
+	SplineDataVisualizationHelpers::SplineDataSplineParameters params(amplitude, width, samples, values, targetValues, blend, scale, derivative, integral, derivativeScale, integralScale, sampleSpacing, closed, splineType, splineInterpolation, splineSubdivision, splineAngle, splineMaxLength);
 
-	// Alloc a SplineObject and check it.
-	SplineObject* splineObjPtr = SplineObject::Alloc(params.samples, params.splineType);
+	// Alloc a SplineObject holding the curve and its overlays, and check it.
+	SplineObject* splineObjPtr = SplineObject::Alloc((Int32)params.samples * params.GetSegmentCount(), params.splineType);
 	if (!splineObjPtr)
 		return nullptr;
 
 	// Invoke the helper function to set the SplineObject object member accordingly
-	iferr (SplineDataVisualizationHelpers::CreateSplineDataSpline(*splineObjPtr, params))
+	iferr (SplineDataVisualizationHelpers::CreateSplineDataSpline(*splineObjPtr, params, contourValues))
 	{
 		DiagnosticOutput("Error on CreateSplineDataSpline: @", err);
 		SplineObject::Free(splineObjPtr);
 		return nullptr;
 	}
 
+	Vector* splinePntsPtr = splineObjPtr->GetPointW();
+	if (!splinePntsPtr)
+	{
+		SplineObject::Free(splineObjPtr);
+		return nullptr;
+	}
+
+	// The curve's tangents follow the slopes of its samples, or the derivatives of the stored contour
+	Tangent* splineTangentsPtr = nullptr;
+	if (curveTangents)
+	{
+		splineTangentsPtr = splineObjPtr->GetTangentW();
+		if (!splineTangentsPtr && splineObjPtr->MakeVariableTag(Ttangent, splineObjPtr->GetPointCount()))
+			splineTangentsPtr = splineObjPtr->GetTangentW();
+		iferr (_sampleDerivatives.Resize(samples))
+		{
+			DiagnosticOutput("Error on allocating tangents: @", err);
+			splineTangentsPtr = nullptr;
+		}
+		if (!splineTangentsPtr)
+		{
+			SplineObject::Free(splineObjPtr);
+			return nullptr;
+		}
+
+		if (contourValues)
+		{
+			for (UInt32 sampleIndex = 0; sampleIndex < samples; ++sampleIndex)
+				_sampleDerivatives[sampleIndex] = contourValues[contourPointCount + sampleIndex];
+		}
+		else
+		{
+			SplineDataVisualizationHelpers::ComputeSplineDataSampleDerivatives(_sampleDerivatives.GetFirst(), samples, scale, values, slopes, targetValues, targetSlopes, blend, sampleSpacing);
+		}
+		SplineDataVisualizationHelpers::WriteSplineDataCurveTangents(splineTangentsPtr, _sampleDerivatives.GetFirst(), samples, width / ((Float)samples - 1));
+	}
+	else
+	{
+		_sampleDerivatives.Reset();
+	}
+
+	// Keep the new contour, so it can be stored with the document. Approximated contours are not kept.
+	if (!contourValues && !refinementPending)
+	{
+		iferr (_persistedContour.Store(splineObjPtr->GetPointR(), splineObjPtr->GetPointCount(), splineTangentsPtr ? _sampleDerivatives.GetFirst() : nullptr, splineTangentsPtr ? (Int32)samples : 0, contourHash))
+		{
+			DiagnosticOutput("Error on storing contour: @", err);
+			_persistedContour.Reset();
+		}
+	}
+
+	// Polar layout: the x position selects the angle, the mapped value becomes the radius.
+	// The stored contour keeps the cartesian values, as they don't depend on the angles.
+	if (objectDataPtr->GetInt32(OSPLINEDATA_LAYOUT, OSPLINEDATA_LAYOUT_CARTESIAN) == OSPLINEDATA_LAYOUT_POLAR)
+	{
+		const Float startAngle = objectDataPtr->GetFloat(OSPLINEDATA_POLAR_START_ANGLE, 0.0);
+		const Float sweepAngle = objectDataPtr->GetFloat(OSPLINEDATA_POLAR_SWEEP, SplineDataVisualizationHelpers::DEFAULT_POLAR_SWEEP);
+		iferr (_polarTable.Update(samples, startAngle, sweepAngle))
+		{
+			DiagnosticOutput("Error on building polar table: @", err);
+			SplineObject::Free(splineObjPtr);
+			return nullptr;
+		}
+
+		// The curve's tangents are turned with its points
+		if (splineTangentsPtr)
+			SplineDataVisualizationHelpers::ApplySplineDataPolarLayout(splinePntsPtr, splineTangentsPtr, samples, _polarTable.GetCosValues(), _polarTable.GetSinValues(), sweepAngle / ((Float)samples - 1));
+		else
+			SplineDataVisualizationHelpers::ApplySplineDataPolarLayout(splinePntsPtr, samples, _polarTable.GetCosValues(), _polarTable.GetSinValues());
+		for (Int32 segmentIndex = 1; segmentIndex < params.GetSegmentCount(); ++segmentIndex)
+			SplineDataVisualizationHelpers::ApplySplineDataPolarLayout(splinePntsPtr + segmentIndex * (Int)samples, samples, _polarTable.GetCosValues(), _polarTable.GetSinValues());
+	}
+	else
+	{
+		_polarTable.Reset();
+	}
+
+	// The overlays have no known derivative, their tangents interpolate the points
+	if (splineTangentsPtr)
+	{
+		for (Int32 segmentIndex = 1; segmentIndex < params.GetSegmentCount(); ++segmentIndex)
+			SplineDataVisualizationHelpers::WriteSplineDataCatmullRomTangents(splineTangentsPtr + segmentIndex * (Int)samples, splinePntsPtr + segmentIndex * (Int)samples, samples);
+	}
+
 	splineObjPtr->Message(MSG_UPDATE);
 
 	return splineObjPtr;
@@ -255,9 +706,31 @@ Bool SplineDataSplineObject::GetDEnabling(GeListNode *node, const DescID &id, co
 		return false;
 
 	Int32 interpolation = objectDataPtr->GetInt32(SPLINEOBJECT_INTERPOLATION);
+	const Bool polar = objectDataPtr->GetInt32(OSPLINEDATA_LAYOUT) == OSPLINEDATA_LAYOUT_POLAR;
 
 	switch (id[0].id)
 	{
+		// Layout attributes
+		case OSPLINEDATA_WIDTH:
+			return !polar;
+		case OSPLINEDATA_POLAR_START_ANGLE:
+		case OSPLINEDATA_POLAR_SWEEP:
+			return polar;
+
+		// Morph attributes
+		case OSPLINEDATA_MORPH_SPLINECURVE:
+		case OSPLINEDATA_MORPH_BLEND:
+			return objectDataPtr->GetBool(OSPLINEDATA_MORPH);
+
+		// Overlay attributes
+		case OSPLINEDATA_DERIVATIVE_SCALE:
+			return objectDataPtr->GetBool(OSPLINEDATA_DERIVATIVE);
+		case OSPLINEDATA_INTEGRAL_SCALE:
+			return objectDataPtr->GetBool(OSPLINEDATA_INTEGRAL);
+
+		// SplineObject standard attributes, curve tangents always produce a Bezier spline
+		case SPLINEOBJECT_TYPE:
+			return !objectDataPtr->GetBool(OSPLINEDATA_TANGENTS);
 		case SPLINEOBJECT_ANGLE:
 			return interpolation == SPLINEOBJECT_INTERPOLATION_ADAPTIVE || interpolation == SPLINEOBJECT_INTERPOLATION_SUBDIV;
 		case SPLINEOBJECT_MAXIMUMLENGTH:
@@ -269,6 +742,53 @@ Bool SplineDataSplineObject::GetDEnabling(GeListNode *node, const DescID &id, co
 	return SUPER::GetDEnabling(node, id, t_data, flags, itemdesc);
 }
 
+Bool SplineDataSplineObject::Message(GeListNode* node, Int32 type, void* data)
+{
+	// Hand the regeneration job to the scheduler
+	if (type == SplineDataVisualizationHelpers::MSG_SPLINEDATA_GETREGENERATIONJOB && data)
+	{
+		static_cast<SplineDataVisualizationHelpers::SplineDataRegenerationJobMessage*>(data)->job = this;
+		return true;
+	}
+
+	return SUPER::Message(node, type, data);
+}
+
+Bool SplineDataSplineObject::Read(GeListNode* node, HyperFile* hf, Int32 level)
+{
+	// Documents saved before the contour was stored don't contain it
+	if (level >= SplineDataVisualizationHelpers::DISKLEVEL_SPLINEDATASPLINE_CONTOUR)
+	{
+		if (!_persistedContour.Read(hf))
+			return false;
+	}
+
+	return SUPER::Read(node, hf, level);
+}
+
+Bool SplineDataSplineObject::Write(GeListNode* node, HyperFile* hf)
+{
+	if (!_persistedContour.Write(hf))
+		return false;
+
+	return SUPER::Write(node, hf);
+}
+
+Bool SplineDataSplineObject::CopyTo(NodeData* dest, GeListNode* snode, GeListNode* dnode, COPYFLAGS flags, AliasTrans* trn)
+{
+	SplineDataSplineObject* destObject = static_cast<SplineDataSplineObject*>(dest);
+	if (!destObject)
+		return false;
+
+	iferr (destObject->_persistedContour.CopyFrom(_persistedContour))
+	{
+		DiagnosticOutput("Error on copying contour: @", err);
+		destObject->_persistedContour.Reset();
+	}
+
+	return SUPER::CopyTo(dest, snode, dnode, flags, trn);
+}
+
 
 Bool RegisterSplineDataSpline()
 {
@@ -276,5 +796,5 @@ Bool RegisterSplineDataSpline()
 	if (!registeredName.IsPopulated())
 		return false;
 
-	return RegisterObjectPlugin(SplineDataVisualizationHelpers::ID_OBJECTDATA_SPLINEDATASPLINE, registeredName, OBJECT_GENERATOR|OBJECT_ISSPLINE, SplineDataSplineObject::Alloc, "osplinedataspline"_s, AutoBitmap("osplinedataspline.tif"_s), 0);
+	return RegisterObjectPlugin(SplineDataVisualizationHelpers::ID_OBJECTDATA_SPLINEDATASPLINE, registeredName, OBJECT_GENERATOR|OBJECT_ISSPLINE, SplineDataSplineObject::Alloc, "osplinedataspline"_s, AutoBitmap("osplinedataspline.tif"_s), SplineDataVisualizationHelpers::DISKLEVEL_SPLINEDATASPLINE_CONTOUR);
 }
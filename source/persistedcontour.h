@@ -0,0 +1,146 @@
+#ifndef PERSISTEDCONTOUR_H__
+#define PERSISTEDCONTOUR_H__
+
+#include "c4d.h"
+#include "maxon/basearray.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// Holds the y values of the last generated contour together with a hash of the
+	/// parameters it was generated from, and stores them in the document. After loading,
+	/// the contour can be rebuilt from the stored values until a parameter changes,
+	/// without sampling the curves again.
+	/// The x values are not stored, as the points are evenly spaced along the x axis.
+	/// With curve tangents, the derivatives the tangents were written from follow the y values.
+	//----------------------------------------------------------------------------------------
+	class SplineDataPersistedContour
+	{
+	public:
+		/// \brief Returns true if the stored contour was generated from parameters with the given hash, and has the given number of values
+		Bool IsValid(UInt64 parameterHash, UInt32 valueCount) const
+		{
+			return _valid && _parameterHash == parameterHash && _values.GetCount() == (Int)valueCount;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Stores the y values of a contour, followed by the derivatives of its tangents, if any.
+		/// @brief Stores the y values of a contour.
+		/// @param[in] points							The contour's points
+		/// @param[in] pointCount					Number of points
+		/// @param[in] derivatives				Derivatives the contour's tangents were written from, or nullptr
+		/// @param[in] derivativeCount		Number of derivatives
+		/// @param[in] parameterHash			Hash of the parameters the contour was generated from
+		/// @return												OK on success
+		//----------------------------------------------------------------------------------------
+		maxon::Result<void> Store(const Vector *points, Int32 pointCount, const Float *derivatives, Int32 derivativeCount, UInt64 parameterHash)
+		{
+			iferr_scope;
+
+			if (!points || (!derivatives && derivativeCount > 0))
+				return maxon::NullptrError(MAXON_SOURCE_LOCATION);
+
+			_valid = false;
+			_values.Resize(pointCount + derivativeCount) iferr_return;
+			for (Int32 pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+				_values[pointIndex] = (Float32)points[pointIndex].y;
+			for (Int32 derivativeIndex = 0; derivativeIndex < derivativeCount; ++derivativeIndex)
+				_values[pointCount + derivativeIndex] = (Float32)derivatives[derivativeIndex];
+
+			_parameterHash = parameterHash;
+			_valid = true;
+			return maxon::OK;
+		}
+
+		/// \brief Returns the stored values, the y values followed by the derivatives
+		const Float32 *GetValues() const
+		{
+			return _values.GetFirst();
+		}
+
+		/// \brief Discards the stored contour
+		void Reset()
+		{
+			_values.Reset();
+			_valid = false;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Reads a stored contour from a HyperFile.
+		/// @brief Reads a stored contour from a HyperFile.
+		/// @param[in] hf									The HyperFile to read from
+		/// @return												False if reading from the file failed
+		//----------------------------------------------------------------------------------------
+		Bool Read(HyperFile *hf)
+		{
+			Reset();
+
+			Bool valid = false;
+			Int32 valueCount = 0;
+			if (!hf || !hf->ReadBool(&valid) || !hf->ReadUInt64(&_parameterHash) || !hf->ReadInt32(&valueCount))
+				return false;
+			if (!valid || valueCount <= 0)
+				return true;
+
+			void *data = nullptr;
+			Int size = 0;
+			if (!hf->ReadMemory(&data, &size))
+				return false;
+
+			// Only use the stored contour if its size is consistent, but never fail loading because of it
+			if (data && size == valueCount * (Int)sizeof(Float32))
+			{
+				iferr (_values.Resize(valueCount))
+				{
+					DeleteMem(data);
+					return true;
+				}
+				CopyMem(data, _values.GetFirst(), size);
+				_valid = true;
+			}
+			DeleteMem(data);
+			return true;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Writes the stored contour to a HyperFile.
+		/// @brief Writes the stored contour to a HyperFile.
+		/// @param[in] hf									The HyperFile to write to
+		/// @return												False if writing to the file failed
+		//----------------------------------------------------------------------------------------
+		Bool Write(HyperFile *hf) const
+		{
+			if (!hf)
+				return false;
+
+			const Bool valid = _valid && !_values.IsEmpty();
+			const Int32 valueCount = valid ? (Int32)_values.GetCount() : 0;
+			if (!hf->WriteBool(valid) || !hf->WriteUInt64(_parameterHash) || !hf->WriteInt32(valueCount))
+				return false;
+			if (!valid)
+				return true;
+
+			return hf->WriteMemory(_values.GetFirst(), valueCount * (Int)sizeof(Float32));
+		}
+
+		/// \brief Copies another stored contour
+		maxon::Result<void> CopyFrom(const SplineDataPersistedContour &src)
+		{
+			iferr_scope;
+
+			_valid = false;
+			_values.CopyFrom(src._values) iferr_return;
+			_parameterHash = src._parameterHash;
+			_valid = src._valid;
+			return maxon::OK;
+		}
+
+	private:
+		maxon::BaseArray<Float32> _values;
+		UInt64 _parameterHash = 0;
+		Bool _valid = false;
+	};
+}
+
+#endif // PERSISTEDCONTOUR_H__
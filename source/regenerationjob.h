@@ -0,0 +1,124 @@
+#ifndef REGENERATIONJOB_H__
+#define REGENERATIONJOB_H__
+
+#include "c4d.h"
+#include "commons.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	class SplineDataRegenerationJob;
+
+	/// Message sent to chart generators to retrieve their regeneration job
+	static const Int32 MSG_SPLINEDATA_GETREGENERATIONJOB = ID_SCENEHOOK_REGENERATIONSCHEDULER;
+
+	/// \brief Asks for another evaluation of the active document, can be called from any thread
+	inline void RequestSplineDataRefinement()
+	{
+		SpecialEventAdd(ID_MESSAGEDATA_SPLINEDATAREFINEMENT);
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Data of MSG_SPLINEDATA_GETREGENERATIONJOB
+	//----------------------------------------------------------------------------------------
+	struct SplineDataRegenerationJobMessage
+	{
+		SplineDataRegenerationJob *job = nullptr; ///< Set by the generator
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Base class of chart generators whose contour can be built ahead of the generator pass.
+	/// The regeneration scheduler builds the contours of all outdated generators of a document
+	/// in parallel, and GetContour() then only hands back the precomputed result.
+	/// A contour is up to date as long as the generator's data dirty count doesn't change,
+	/// and it was not built from approximated samples that still have to be refined.
+	//----------------------------------------------------------------------------------------
+	class SplineDataRegenerationJob
+	{
+	public:
+		virtual ~SplineDataRegenerationJob()
+		{
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Builds the contour of the generator from its current parameters.
+		/// The scheduler calls this for several generators in parallel, so implementations
+		/// must only access the generator and their own members.
+		/// @brief Builds the contour of the generator.
+		/// @param[in] op									The generator
+		/// @param[in] bt									The evaluating thread, may be nullptr
+		/// @return												The contour, or nullptr if it could not be built
+		//----------------------------------------------------------------------------------------
+		virtual SplineObject* BuildContour(BaseObject &op, BaseThread *bt) = 0;
+
+		/// \brief Returns true if the generator's parameters have changed since its contour was last built, or if the contour has to be refined
+		Bool IsOutdated(const BaseObject &op) const
+		{
+			return op.GetDirty(DIRTYFLAGS::DATA) != _dirty || _refinementPending;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Marks the generator dirty while its last contour has to be refined. Call from CheckDirty().
+		/// The job recognizes its own dirty count change, so a contour the scheduler has just
+		/// precomputed for this pass is still handed to GetContour().
+		/// @brief Marks the generator dirty while its contour has to be refined.
+		/// @param[in] op									The generator
+		//----------------------------------------------------------------------------------------
+		void CheckRefinement(BaseObject &op)
+		{
+			if (!_refinementPending)
+				return;
+
+			const Bool upToDate = op.GetDirty(DIRTYFLAGS::DATA) == _dirty;
+			op.SetDirty(DIRTYFLAGS::DATA);
+			if (upToDate)
+				_dirty = op.GetDirty(DIRTYFLAGS::DATA);
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Builds the contour and keeps it until TakeContour() is called.
+		/// @brief Builds the contour and keeps it until TakeContour() is called.
+		/// @param[in] op									The generator
+		/// @param[in] dirty							The generator's data dirty count, read before the parallel pass
+		/// @param[in] bt									The evaluating thread, may be nullptr
+		//----------------------------------------------------------------------------------------
+		void Precompute(BaseObject &op, UInt32 dirty, BaseThread *bt)
+		{
+			_contour.Free();
+			_contour.Set(BuildContour(op, bt));
+			_dirty = dirty;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Returns the precomputed contour if it is still up to date, and builds it otherwise.
+		/// @brief Returns the precomputed contour, or builds it.
+		/// @param[in] op									The generator
+		/// @param[in] bt									The evaluating thread, may be nullptr
+		/// @return												The contour, ownership goes to the caller
+		//----------------------------------------------------------------------------------------
+		SplineObject* TakeContour(BaseObject &op, BaseThread *bt)
+		{
+			const UInt32 dirty = op.GetDirty(DIRTYFLAGS::DATA);
+			if (_contour && dirty == _dirty)
+				return _contour.Release();
+
+			_contour.Free();
+			_dirty = dirty;
+			return BuildContour(op, bt);
+		}
+
+	protected:
+		/// \brief Called by BuildContour() implementations, true if the contour was built from approximated samples
+		void SetRefinementPending(Bool pending)
+		{
+			_refinementPending = pending;
+		}
+
+	private:
+		AutoFree<SplineObject> _contour; ///< Precomputed contour, not yet handed to GetContour()
+		UInt32 _dirty = 0;               ///< Data dirty count of the generator when the contour was built
+		Bool _refinementPending = false; ///< The last contour was built from approximated samples
+	};
+}
+
+#endif // REGENERATIONJOB_H__
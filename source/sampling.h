@@ -0,0 +1,838 @@
+#ifndef SAMPLING_H__
+#define SAMPLING_H__
+
+#include "c4d.h"
+#include "customgui_splinecontrol.h"
+#include "maxon/basearray.h"
+#include "commons.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	/// \brief Mixes the bytes of a value into an FNV-1a hash
+	template <typename T>
+	inline void HashCombine(UInt64 &hash, const T &value)
+	{
+		const UChar *bytes = reinterpret_cast<const UChar*>(&value);
+		for (Int i = 0; i < (Int)sizeof(T); ++i)
+		{
+			hash ^= (UInt64)bytes[i];
+			hash *= 1099511628211ULL;
+		}
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Computes a hash over all knots of a SplineData.
+	/// @brief Computes a hash over all knots of a SplineData.
+	/// @param[in] splineData					The SplineData to hash
+	/// @return												Hash value, changes whenever the shape of the curve changes
+	//----------------------------------------------------------------------------------------
+	inline UInt64 GetSplineDataHash(SplineData *splineData)
+	{
+		UInt64 hash = 14695981039346656037ULL;
+		if (!splineData)
+			return hash;
+
+		const Int32 knotCount = splineData->GetKnotCount();
+		HashCombine(hash, knotCount);
+		for (Int32 knotIndex = 0; knotIndex < knotCount; ++knotIndex)
+		{
+			const CustomSplineKnot *knot = splineData->GetKnot(knotIndex);
+			if (!knot)
+				continue;
+			HashCombine(hash, knot->vPos);
+			HashCombine(hash, knot->vTangentLeft);
+			HashCombine(hash, knot->vTangentRight);
+			HashCombine(hash, knot->interpol);
+		}
+		return hash;
+	}
+
+	/// \brief Samples the y values of splineData at count evenly spaced positions from 0.0 to 1.0, stored in single precision
+	inline void SampleSplineData(SplineData &splineData, Float32 *values, Int count)
+	{
+		const Float step = count > 1 ? 1.0 / (Float)(count - 1) : 0.0;
+		for (Int sampleIndex = 0; sampleIndex < count; ++sampleIndex)
+			values[sampleIndex] = (Float32)splineData.GetPoint((Float)sampleIndex * step).y;
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Returns the range of sample indices whose positions lie in an x interval, widened to
+	/// the samples just outside of it.
+	/// @brief Returns the range of sample indices covering an x interval.
+	/// @param[in] xStart							Start of the interval (0.0 - 1.0)
+	/// @param[in] xEnd								End of the interval (0.0 - 1.0)
+	/// @param[in] count							Number of evenly spaced samples from 0.0 to 1.0
+	/// @param[out] firstIndex				First sample index
+	/// @param[out] lastIndex					Last sample index
+	/// @return												False if no sample lies in the interval
+	//----------------------------------------------------------------------------------------
+	inline Bool GetSampleIndexRange(Float xStart, Float xEnd, Int count, Int &firstIndex, Int &lastIndex)
+	{
+		if (count < 2 || xEnd < xStart)
+			return false;
+
+		const Float lastSample = (Float)(count - 1);
+		firstIndex = ClampValue((Int)Floor(xStart * lastSample), (Int)0, count - 1);
+		lastIndex = ClampValue((Int)Ceil(xEnd * lastSample), (Int)0, count - 1);
+		return firstIndex <= lastIndex;
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Copy of the knots of a SplineData. Compared to the current knots, it tells which x
+	/// interval of the curve was affected by an edit, so only the samples in that interval
+	/// need to be evaluated again.
+	//----------------------------------------------------------------------------------------
+	class SplineDataKnotSnapshot
+	{
+	public:
+		/// Number of neighboring knots on each side of an edited knot whose curve sections may change.
+		/// Automatic tangents depend on the neighboring knots, so an edit reaches two knots far.
+		static const Int32 KNOT_REACH = 2;
+
+		/// \brief Copies the knots of splineData
+		maxon::Result<void> Capture(SplineData *splineData)
+		{
+			iferr_scope;
+
+			_valid = false;
+			if (!splineData)
+				return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+
+			const Int32 knotCount = splineData->GetKnotCount();
+			_knots.Resize(knotCount) iferr_return;
+			for (Int32 knotIndex = 0; knotIndex < knotCount; ++knotIndex)
+			{
+				const CustomSplineKnot *knot = splineData->GetKnot(knotIndex);
+				if (!knot)
+					return maxon::UnexpectedError(MAXON_SOURCE_LOCATION);
+				_knots[knotIndex] = Knot(*knot);
+			}
+
+			_valid = true;
+			return maxon::OK;
+		}
+
+		/// \brief Discards the snapshot
+		void Reset()
+		{
+			_knots.Reset();
+			_valid = false;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Finds the x interval in which the curve may differ from the snapshot.
+		/// @brief Finds the x interval in which the curve may differ from the snapshot.
+		/// @param[in] splineData					The current curve
+		/// @param[out] xStart						Start of the interval, larger than xEnd if no knot has changed
+		/// @param[out] xEnd							End of the interval
+		/// @return												False if the interval can't be determined, e.g. because knots were added or removed
+		//----------------------------------------------------------------------------------------
+		Bool GetChangedInterval(SplineData *splineData, Float &xStart, Float &xEnd) const
+		{
+			if (!_valid || !splineData || splineData->GetKnotCount() != (Int32)_knots.GetCount())
+				return false;
+
+			// Find the first and last changed knot, and the x range covered by their old and new positions
+			const Int32 knotCount = (Int32)_knots.GetCount();
+			Int32 firstChanged = NOTOK;
+			Int32 lastChanged = NOTOK;
+			xStart = 1.0;
+			xEnd = 0.0;
+			for (Int32 knotIndex = 0; knotIndex < knotCount; ++knotIndex)
+			{
+				const CustomSplineKnot *knot = splineData->GetKnot(knotIndex);
+				if (!knot)
+					return false;
+				if (_knots[knotIndex] == Knot(*knot))
+					continue;
+
+				if (firstChanged == NOTOK)
+					firstChanged = knotIndex;
+				lastChanged = knotIndex;
+				xStart = Min(xStart, Min(_knots[knotIndex].position.x, knot->vPos.x));
+				xEnd = Max(xEnd, Max(_knots[knotIndex].position.x, knot->vPos.x));
+			}
+			if (firstChanged == NOTOK)
+				return true;
+
+			// Widen the interval to the neighboring knots, or to the ends of the curve
+			const Int32 lowerKnot = firstChanged - KNOT_REACH;
+			const Int32 upperKnot = lastChanged + KNOT_REACH;
+			if (lowerKnot < 0)
+				xStart = 0.0;
+			else
+				xStart = Min(xStart, Min(_knots[lowerKnot].position.x, splineData->GetKnot(lowerKnot)->vPos.x));
+			if (upperKnot >= knotCount)
+				xEnd = 1.0;
+			else
+				xEnd = Max(xEnd, Max(_knots[upperKnot].position.x, splineData->GetKnot(upperKnot)->vPos.x));
+			return true;
+		}
+
+	private:
+		/// \brief The knot values that affect the shape of the curve
+		struct Knot
+		{
+			Vector position;
+			Vector tangentLeft;
+			Vector tangentRight;
+			Int32 interpolation;
+
+			Knot() : interpolation(0)
+			{
+			}
+
+			explicit Knot(const CustomSplineKnot &knot) : position(knot.vPos), tangentLeft(knot.vTangentLeft), tangentRight(knot.vTangentRight), interpolation((Int32)knot.interpol)
+			{
+			}
+
+			Bool operator ==(const Knot &other) const
+			{
+				return position == other.position && tangentLeft == other.tangentLeft && tangentRight == other.tangentRight && interpolation == other.interpolation;
+			}
+		};
+
+		maxon::BaseArray<Knot> _knots;
+		Bool _valid = false;
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Holds the sampled values of a SplineData, and only re-samples when the curve
+	/// or the number of samples has changed. When knots were only moved, just the samples
+	/// in the x interval affected by the edit are evaluated again.
+	/// Only the y values are stored, in single precision. The x values are implicit, as the
+	/// samples are evenly spaced, and z is always 0.0.
+	//----------------------------------------------------------------------------------------
+	class SplineDataSampleCache
+	{
+	public:
+		//----------------------------------------------------------------------------------------
+		/// Re-samples the curve if necessary.
+		/// @brief Re-samples the curve if necessary.
+		/// @param[in] splineData				The curve to sample
+		/// @param[in] samples					Number of samples
+		/// @return											True if the cache was re-sampled, false if it was still valid
+		//----------------------------------------------------------------------------------------
+		maxon::Result<Bool> Update(SplineData *splineData, UInt32 samples)
+		{
+			iferr_scope;
+
+			if (!splineData || samples == 0)
+				return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+
+			const UInt64 hash = GetSplineDataHash(splineData);
+			if (_valid && hash == _hash && (Int)samples == _values.GetCount())
+				return false;
+
+			// Only re-evaluate the interval affected by the edit, if it can be determined
+			Float xStart = 0.0;
+			Float xEnd = 1.0;
+			const Bool incremental = _valid && (Int)samples == _values.GetCount() && _knots.GetChangedInterval(splineData, xStart, xEnd);
+
+			_valid = false;
+			if (incremental)
+			{
+				Int firstIndex = 0;
+				Int lastIndex = 0;
+				if (GetSampleIndexRange(xStart, xEnd, _values.GetCount(), firstIndex, lastIndex))
+				{
+					const Float step = 1.0 / (Float)(_values.GetCount() - 1);
+					for (Int sampleIndex = firstIndex; sampleIndex <= lastIndex; ++sampleIndex)
+						_values[sampleIndex] = (Float32)splineData->GetPoint((Float)sampleIndex * step).y;
+				}
+			}
+			else
+			{
+				_values.Resize(samples) iferr_return;
+				SampleSplineData(*splineData, _values.GetFirst(), _values.GetCount());
+			}
+			_knots.Capture(splineData) iferr_return;
+
+			_hash = hash;
+			_valid = true;
+			return true;
+		}
+
+		/// \brief Invalidates the cache, forcing a re-sample on the next Update()
+		void Reset()
+		{
+			_values.Reset();
+			_knots.Reset();
+			_valid = false;
+		}
+
+		/// \brief Returns the cached values
+		const Float32* GetValues() const
+		{
+			return _values.GetFirst();
+		}
+
+		/// \brief Returns the number of cached values
+		Int GetCount() const
+		{
+			return _values.GetCount();
+		}
+
+	private:
+		maxon::BaseArray<Float32> _values;
+		SplineDataKnotSnapshot _knots;
+		UInt64 _hash = 0;
+		Bool _valid = false;
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Time budget for sampling in the editor. Sampling code checks it regularly, and stops
+	/// evaluating the curve once the budget is used up or the thread was asked to stop.
+	/// A default constructed budget is unlimited and never checks the thread, e.g. for rendering.
+	//----------------------------------------------------------------------------------------
+	class SplineDataSamplingBudget
+	{
+	public:
+		/// \brief Unlimited budget
+		SplineDataSamplingBudget() : _thread(nullptr), _deadline(0.0), _limited(false)
+		{
+		}
+
+		/// \brief Budget of milliseconds, starting now
+		SplineDataSamplingBudget(BaseThread *thread, Float milliseconds) : _thread(thread), _deadline(GeGetMilliSeconds() + milliseconds), _limited(true)
+		{
+		}
+
+		/// \brief Returns true if sampling has to stop
+		Bool IsExhausted() const
+		{
+			if (!_limited)
+				return false;
+			if (_thread && _thread->TestBreak())
+				return true;
+			return GeGetMilliSeconds() >= _deadline;
+		}
+
+	private:
+		BaseThread *_thread;
+		Float _deadline;
+		Bool _limited;
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Returns the sampling budget for an evaluation thread. Only viewport redraws are limited,
+	/// rendering and evaluations without a thread sample the curve completely.
+	/// @brief Returns the sampling budget for an evaluation thread.
+	/// @param[in] bt									The evaluating thread, may be nullptr
+	/// @param[in] milliseconds				Budget of viewport redraws
+	/// @return												The budget
+	//----------------------------------------------------------------------------------------
+	inline SplineDataSamplingBudget GetSplineDataSamplingBudget(BaseThread *bt, Float milliseconds)
+	{
+		if (bt && IdentifyThread(bt) == THREADTYPE::EDITORREDRAW)
+			return SplineDataSamplingBudget(bt, milliseconds);
+		return SplineDataSamplingBudget();
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Range of sample indices that only hold approximated values and still have to be evaluated
+	//----------------------------------------------------------------------------------------
+	struct SplineDataPendingRange
+	{
+		Int first = 0;
+		Int last = -1;
+
+		/// \brief Returns true if no samples are pending
+		Bool IsEmpty() const
+		{
+			return last < first;
+		}
+
+		/// \brief Extends the range to also cover the samples from firstIndex to lastIndex
+		void Add(Int firstIndex, Int lastIndex)
+		{
+			if (IsEmpty())
+			{
+				first = firstIndex;
+				last = lastIndex;
+			}
+			else
+			{
+				first = Min(first, firstIndex);
+				last = Max(last, lastIndex);
+			}
+		}
+
+		/// \brief Marks all samples as evaluated
+		void Clear()
+		{
+			first = 0;
+			last = -1;
+		}
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Mip-style pyramid of samples of a SplineData curve over its full x range.
+	/// Level 0 holds the base number of samples, each further level doubles the resolution.
+	/// Levels are aligned, so a level only needs to evaluate the curve in between the
+	/// samples of the level below. Levels are built on demand and kept until the curve
+	/// or the base sample count changes. Like SplineDataSampleCache, levels only store the
+	/// y values in single precision, and only the interval affected by a knot edit is
+	/// evaluated again in each level that was built.
+	/// With a limited SplineDataSamplingBudget, samples that could not be evaluated in time
+	/// are interpolated from the level below, or from a few samples of the curve in level 0,
+	/// and evaluated by later updates.
+	/// Ranges zoomed in further than the finest level, or than the levels that are cheap
+	/// enough to build, are sampled directly, and only the last such range is kept.
+	/// Optionally, the slope of the curve is kept next to each sample. It is evaluated in the
+	/// same loops and under the same budget as the samples, and approximated the same way.
+	//----------------------------------------------------------------------------------------
+	class SplineDataSamplePyramid
+	{
+	public:
+		static const Int32 MAX_LEVELS = 7;
+		static const Int SAMPLING_CHUNK = 256; ///< Number of samples evaluated between two budget checks
+		static const Int COARSE_STRIDE = 16;   ///< Minimum distance between the evaluated samples of an approximation
+		static const Int APPROXIMATION_SAMPLES = 64; ///< Maximum number of samples evaluated for an approximation
+		static const Int DIRECT_SAMPLING_FACTOR = 4; ///< Missing levels are only built if they evaluate at most this many times the samples of a direct range
+
+		//----------------------------------------------------------------------------------------
+		/// Invalidates the pyramid if the curve or the base sample count has changed, and makes sure level 0 exists.
+		/// If the pyramid is still valid, pending samples are evaluated as far as the budget allows.
+		/// @brief Invalidates the pyramid if necessary, and builds level 0.
+		/// @param[in] splineData				The curve to sample
+		/// @param[in] baseSamples			Number of samples in level 0
+		/// @param[in] budget						Time budget for evaluating the curve
+		/// @param[in] slopes						True to also keep the slope of the curve at each sample, changing it rebuilds the pyramid
+		/// @return											True if samples have changed, false if the pyramid was still valid
+		//----------------------------------------------------------------------------------------
+		maxon::Result<Bool> Update(SplineData *splineData, UInt32 baseSamples, const SplineDataSamplingBudget &budget = SplineDataSamplingBudget(), Bool slopes = false)
+		{
+			iferr_scope;
+
+			if (!splineData || baseSamples < 2)
+				return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+
+			const UInt64 hash = GetSplineDataHash(splineData);
+			const Bool compatible = _levelCount > 0 && baseSamples == _baseSamples && slopes == _slopes;
+			if (compatible && hash == _hash)
+				return Refine(splineData, budget);
+
+			// If only knots were moved, update the affected interval in all built levels
+			Float xStart = 0.0;
+			Float xEnd = 1.0;
+			if (compatible && _knots.GetChangedInterval(splineData, xStart, xEnd))
+			{
+				const Int32 levelCount = _levelCount;
+				_levelCount = 0;
+				for (Int32 level = 0; level < levelCount; ++level)
+				{
+					Int firstIndex = 0;
+					Int lastIndex = 0;
+					if (GetSampleIndexRange(xStart, xEnd, _levels[level].GetCount(), firstIndex, lastIndex))
+						SampleLevelRange(splineData, level, firstIndex, lastIndex, budget);
+				}
+				_levelCount = levelCount;
+				UpdateDirectRange(splineData, xStart, xEnd, budget);
+				_knots.Capture(splineData) iferr_return;
+				_hash = hash;
+				return true;
+			}
+
+			Reset();
+			_hash = hash;
+			_baseSamples = baseSamples;
+			_slopes = slopes;
+			BuildLevel(splineData, 0, budget) iferr_return;
+			_knots.Capture(splineData) iferr_return;
+			return true;
+		}
+
+		/// \brief Drops all levels, forcing a rebuild on the next Update()
+		void Reset()
+		{
+			for (Int32 level = 0; level < MAX_LEVELS; ++level)
+			{
+				_levels[level].Reset();
+				_levelSlopes[level].Reset();
+				_pending[level].Clear();
+			}
+			_rangeValues.Reset();
+			_rangeSlopes.Reset();
+			_rangePending.Clear();
+			_knots.Reset();
+			_levelCount = 0;
+			_baseSamples = 0;
+			_slopes = false;
+		}
+
+		/// \brief Returns true if all samples of all built levels and of the direct range have been evaluated
+		Bool IsComplete() const
+		{
+			if (!_rangePending.IsEmpty())
+				return false;
+			for (Int32 level = 0; level < _levelCount; ++level)
+			{
+				if (!_pending[level].IsEmpty())
+					return false;
+			}
+			return true;
+		}
+
+		/// \brief Returns the samples of level 0, covering the full x range with the base sample count
+		const Float32* GetBaseValues() const
+		{
+			return _levels[0].GetFirst();
+		}
+
+		/// \brief Returns the slopes of the samples of level 0, or nullptr if the pyramid keeps no slopes
+		const Float32* GetBaseSlopes() const
+		{
+			return _slopes ? _levelSlopes[0].GetFirst() : nullptr;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Fills values with count evenly spaced samples between xStart and xEnd.
+		/// The samples are taken from the coarsest level that still provides at least
+		/// count samples inside the range; missing levels are built first. If that level is
+		/// beyond the finest one, or building it would evaluate more than DIRECT_SAMPLING_FACTOR
+		/// times count samples, only the range itself is sampled.
+		/// @brief Fills values with count evenly spaced samples between xStart and xEnd.
+		/// @param[in] splineData				The curve, needed if a level has to be built
+		/// @param[in] xStart						Start of the visible range (0.0 - 1.0)
+		/// @param[in] xEnd							End of the visible range (0.0 - 1.0), must be larger than xStart
+		/// @param[out] values					Array receiving the samples
+		/// @param[out] slopes					Array receiving the slopes of the samples, or nullptr. Requires a pyramid that keeps slopes.
+		/// @param[in] count						Number of samples to write, must be at least 2
+		/// @param[in] budget						Time budget for building missing levels
+		/// @return											OK on success
+		//----------------------------------------------------------------------------------------
+		maxon::Result<void> SampleRange(SplineData *splineData, Float xStart, Float xEnd, Float32 *values, Float32 *slopes, Int count, const SplineDataSamplingBudget &budget = SplineDataSamplingBudget())
+		{
+			iferr_scope;
+
+			if (_levelCount == 0 || !splineData || !values || (slopes && !_slopes) || count < 2 || xEnd <= xStart)
+				return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+
+			// Find the level that matches the requested range and point budget
+			const Float requiredIntervals = (Float)(count - 1) / (xEnd - xStart);
+			Int32 level = 0;
+			while (level < MAX_LEVELS && (Float)GetIntervalCount(level) < requiredIntervals)
+				++level;
+
+			// Each missing level evaluates the samples in between the ones of the level below
+			Int buildCost = 0;
+			for (Int32 buildLevel = _levelCount; buildLevel <= level && buildLevel < MAX_LEVELS; ++buildLevel)
+				buildCost += GetIntervalCount(buildLevel) / 2;
+
+			if (level == MAX_LEVELS || buildCost > count * DIRECT_SAMPLING_FACTOR)
+			{
+				// Sample the range directly, unless it is still the same as last time
+				if (_rangeValues.GetCount() != count || xStart != _rangeStart || xEnd != _rangeEnd)
+				{
+					_rangeValues.Resize(count) iferr_return;
+					if (_slopes)
+						_rangeSlopes.Resize(count) iferr_return;
+					_rangeStart = xStart;
+					_rangeEnd = xEnd;
+					_rangePending.Clear();
+					SampleDirectRange(splineData, 0, count - 1, budget);
+				}
+				CopyMem(_rangeValues.GetFirst(), values, count * (Int)sizeof(Float32));
+				if (slopes)
+					CopyMem(_rangeSlopes.GetFirst(), slopes, count * (Int)sizeof(Float32));
+				return maxon::OK;
+			}
+
+			for (Int32 buildLevel = _levelCount; buildLevel <= level; ++buildLevel)
+				BuildLevel(splineData, buildLevel, budget) iferr_return;
+
+			// Copy the slice, interpolating between the level's samples
+			InterpolateLevel(level, xStart, (xEnd - xStart) / (Float)(count - 1), values, slopes, 0, count - 1);
+			return maxon::OK;
+		}
+
+	private:
+		/// \brief Returns the number of intervals between the samples of a level
+		Int GetIntervalCount(Int32 level) const
+		{
+			return ((Int)_baseSamples - 1) << level;
+		}
+
+		/// \brief Builds a level, reusing the samples of the level below
+		maxon::Result<void> BuildLevel(SplineData *splineData, Int32 level, const SplineDataSamplingBudget &budget)
+		{
+			iferr_scope;
+
+			if (!splineData || level != _levelCount)
+				return maxon::IllegalArgumentError(MAXON_SOURCE_LOCATION);
+
+			const Int intervalCount = GetIntervalCount(level);
+			_levels[level].Resize(intervalCount + 1) iferr_return;
+			if (_slopes)
+				_levelSlopes[level].Resize(intervalCount + 1) iferr_return;
+			_pending[level].Clear();
+			SampleLevelRange(splineData, level, 0, intervalCount, budget);
+
+			++_levelCount;
+			return maxon::OK;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Samples a range of a level. The level below must already be updated in that range.
+		/// Samples that can't be evaluated within the budget are approximated and marked as pending,
+		/// as are all samples reusing pending samples of the level below.
+		/// @brief Samples a range of a level.
+		/// @param[in] splineData				The curve
+		/// @param[in] level						The level to sample
+		/// @param[in] firstIndex				First sample to update
+		/// @param[in] lastIndex				Last sample to update
+		/// @param[in] budget						Time budget for evaluating the curve
+		//----------------------------------------------------------------------------------------
+		void SampleLevelRange(SplineData *splineData, Int32 level, Int firstIndex, Int lastIndex, const SplineDataSamplingBudget &budget)
+		{
+			const Int stopIndex = EvaluateLevelRange(splineData, level, firstIndex, lastIndex, budget);
+			if (stopIndex <= lastIndex)
+			{
+				ApproximateLevelRange(splineData, level, stopIndex, lastIndex);
+				_pending[level].Add(stopIndex, lastIndex);
+			}
+
+			if (level > 0 && !_pending[level - 1].IsEmpty())
+				_pending[level].Add(_pending[level - 1].first * 2, _pending[level - 1].last * 2);
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Evaluates the pending samples of all built levels, lowest level first, as far as the budget allows.
+		/// Refined samples of a level are reused by the level above, so they become pending there.
+		/// @brief Evaluates pending samples.
+		/// @param[in] splineData				The curve
+		/// @param[in] budget						Time budget for evaluating the curve
+		/// @return											True if any samples were evaluated
+		//----------------------------------------------------------------------------------------
+		Bool Refine(SplineData *splineData, const SplineDataSamplingBudget &budget)
+		{
+			// The direct range is only sampled while it is visible, so it comes first
+			Bool refined = false;
+			if (!_rangePending.IsEmpty())
+			{
+				const Int firstIndex = _rangePending.first;
+				const Int stopIndex = EvaluateDirectRange(splineData, firstIndex, _rangePending.last, budget);
+				refined = stopIndex > firstIndex;
+				if (stopIndex <= _rangePending.last)
+				{
+					_rangePending.first = stopIndex;
+					return refined;
+				}
+				_rangePending.Clear();
+			}
+
+			for (Int32 level = 0; level < _levelCount; ++level)
+			{
+				SplineDataPendingRange &pending = _pending[level];
+				if (pending.IsEmpty())
+					continue;
+
+				const Int firstIndex = pending.first;
+				const Int stopIndex = EvaluateLevelRange(splineData, level, firstIndex, pending.last, budget);
+				if (stopIndex > firstIndex)
+				{
+					refined = true;
+					if (level + 1 < _levelCount)
+						_pending[level + 1].Add(firstIndex * 2, (stopIndex - 1) * 2);
+				}
+
+				if (stopIndex <= pending.last)
+				{
+					pending.first = stopIndex;
+					break;
+				}
+				pending.Clear();
+			}
+			return refined;
+		}
+
+		/// \brief Evaluates the curve at x, and its slope if slope is not nullptr, from samples differenceStep before and after x
+		static void EvaluateSample(SplineData *splineData, Float x, Float differenceStep, Float32 &value, Float32 *slope)
+		{
+			const Float y = splineData->GetPoint(x).y;
+			value = (Float32)y;
+			if (!slope)
+				return;
+
+			// Central difference, second-order one-sided differences at the ends of the curve
+			if (x - differenceStep < 0.0 || x + differenceStep > 1.0)
+			{
+				const Float direction = x - differenceStep < 0.0 ? differenceStep : -differenceStep;
+				const Float yNear = splineData->GetPoint(x + direction).y;
+				const Float yFar = splineData->GetPoint(x + 2.0 * direction).y;
+				*slope = (Float32)((4.0 * yNear - 3.0 * y - yFar) / (2.0 * direction));
+				return;
+			}
+			*slope = (Float32)((splineData->GetPoint(x + differenceStep).y - splineData->GetPoint(x - differenceStep).y) / (2.0 * differenceStep));
+		}
+
+		/// \brief Evaluates a sample of a level, reusing the level below for even samples
+		void EvaluateLevelSample(SplineData *splineData, Int32 level, Int sampleIndex, Float step)
+		{
+			// Even samples coincide with the level below, only the odd ones are evaluated
+			if (level > 0 && !(sampleIndex & 1))
+			{
+				_levels[level][sampleIndex] = _levels[level - 1][sampleIndex >> 1];
+				if (_slopes)
+					_levelSlopes[level][sampleIndex] = _levelSlopes[level - 1][sampleIndex >> 1];
+				return;
+			}
+			EvaluateSample(splineData, (Float)sampleIndex * step, step * SLOPE_DIFFERENCE_STEP, _levels[level][sampleIndex], _slopes ? &_levelSlopes[level][sampleIndex] : nullptr);
+		}
+
+		/// \brief Evaluates a range of a level in chunks, returns the index of the first sample that was not evaluated in time
+		Int EvaluateLevelRange(SplineData *splineData, Int32 level, Int firstIndex, Int lastIndex, const SplineDataSamplingBudget &budget)
+		{
+			const Float step = 1.0 / (Float)GetIntervalCount(level);
+			for (Int chunkIndex = firstIndex; chunkIndex <= lastIndex; chunkIndex += SAMPLING_CHUNK)
+			{
+				if (budget.IsExhausted())
+					return chunkIndex;
+
+				const Int chunkEnd = Min(chunkIndex + SAMPLING_CHUNK - 1, lastIndex);
+				for (Int sampleIndex = chunkIndex; sampleIndex <= chunkEnd; ++sampleIndex)
+					EvaluateLevelSample(splineData, level, sampleIndex, step);
+			}
+			return lastIndex + 1;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Fills a range of a level with approximated values, with a bounded number of curve evaluations.
+		/// Levels above 0 are interpolated from the level below, without evaluating the curve.
+		/// Level 0 evaluates at most APPROXIMATION_SAMPLES evenly spread samples, and interpolates linearly in between;
+		/// the slopes are those of the interpolating line segments.
+		/// @brief Approximates a range of a level.
+		/// @param[in] splineData				The curve
+		/// @param[in] level						The level to approximate
+		/// @param[in] firstIndex				First sample to approximate
+		/// @param[in] lastIndex				Last sample to approximate
+		//----------------------------------------------------------------------------------------
+		void ApproximateLevelRange(SplineData *splineData, Int32 level, Int firstIndex, Int lastIndex)
+		{
+			maxon::BaseArray<Float32> &levelValues = _levels[level];
+			maxon::BaseArray<Float32> &levelSlopes = _levelSlopes[level];
+			if (level > 0)
+			{
+				const maxon::BaseArray<Float32> &lowerValues = _levels[level - 1];
+				const maxon::BaseArray<Float32> &lowerSlopes = _levelSlopes[level - 1];
+				for (Int sampleIndex = firstIndex; sampleIndex <= lastIndex; ++sampleIndex)
+				{
+					const Int lowerIndex = sampleIndex >> 1;
+					levelValues[sampleIndex] = (sampleIndex & 1) ? (Float32)(((Float)lowerValues[lowerIndex] + (Float)lowerValues[lowerIndex + 1]) * 0.5) : lowerValues[lowerIndex];
+					if (_slopes)
+						levelSlopes[sampleIndex] = (sampleIndex & 1) ? (Float32)(((Float)lowerSlopes[lowerIndex] + (Float)lowerSlopes[lowerIndex + 1]) * 0.5) : lowerSlopes[lowerIndex];
+				}
+				return;
+			}
+
+			Int stride = (lastIndex - firstIndex) / APPROXIMATION_SAMPLES + 1;
+			if (stride < COARSE_STRIDE)
+				stride = COARSE_STRIDE;
+			const Float step = 1.0 / (Float)GetIntervalCount(level);
+			Float32 startValue = (Float32)splineData->GetPoint((Float)firstIndex * step).y;
+			Float slope = 0.0;
+			for (Int coarseIndex = firstIndex; coarseIndex < lastIndex; coarseIndex += stride)
+			{
+				const Int nextIndex = Min(coarseIndex + stride, lastIndex);
+				const Float32 endValue = (Float32)splineData->GetPoint((Float)nextIndex * step).y;
+				const Float valueStep = (Float)(endValue - startValue) / (Float)(nextIndex - coarseIndex);
+				slope = valueStep / step;
+				for (Int sampleIndex = coarseIndex; sampleIndex < nextIndex; ++sampleIndex)
+				{
+					levelValues[sampleIndex] = (Float32)((Float)startValue + valueStep * (Float)(sampleIndex - coarseIndex));
+					if (_slopes)
+						levelSlopes[sampleIndex] = (Float32)slope;
+				}
+				startValue = endValue;
+			}
+			levelValues[lastIndex] = startValue;
+			if (_slopes)
+				levelSlopes[lastIndex] = (Float32)slope;
+		}
+
+		/// \brief Writes the samples firstIndex to lastIndex of a range starting at xStart, and their slopes if slopes is not nullptr, interpolated linearly from a level
+		void InterpolateLevel(Int32 level, Float xStart, Float xStep, Float32 *values, Float32 *slopes, Int firstIndex, Int lastIndex) const
+		{
+			const Float32 *levelValues = _levels[level].GetFirst();
+			const Float32 *levelSlopes = _levelSlopes[level].GetFirst();
+			const Int lastLevelIndex = _levels[level].GetCount() - 1;
+			const Float posScale = (Float)lastLevelIndex;
+			for (Int sampleIndex = firstIndex; sampleIndex <= lastIndex; ++sampleIndex)
+			{
+				const Float pos = (xStart + (Float)sampleIndex * xStep) * posScale;
+				const Int index = ClampValue((Int)pos, (Int)0, lastLevelIndex - 1);
+				const Float t = pos - (Float)index;
+				values[sampleIndex] = (Float32)((Float)levelValues[index] + (Float)(levelValues[index + 1] - levelValues[index]) * t);
+				if (slopes)
+					slopes[sampleIndex] = (Float32)((Float)levelSlopes[index] + (Float)(levelSlopes[index + 1] - levelSlopes[index]) * t);
+			}
+		}
+
+		/// \brief Evaluates a range of the direct range's samples in chunks, returns the index of the first sample that was not evaluated in time
+		Int EvaluateDirectRange(SplineData *splineData, Int firstIndex, Int lastIndex, const SplineDataSamplingBudget &budget)
+		{
+			const Float xStep = (_rangeEnd - _rangeStart) / (Float)(_rangeValues.GetCount() - 1);
+			for (Int chunkIndex = firstIndex; chunkIndex <= lastIndex; chunkIndex += SAMPLING_CHUNK)
+			{
+				if (budget.IsExhausted())
+					return chunkIndex;
+
+				const Int chunkEnd = Min(chunkIndex + SAMPLING_CHUNK - 1, lastIndex);
+				for (Int sampleIndex = chunkIndex; sampleIndex <= chunkEnd; ++sampleIndex)
+					EvaluateSample(splineData, _rangeStart + (Float)sampleIndex * xStep, xStep * SLOPE_DIFFERENCE_STEP, _rangeValues[sampleIndex], _slopes ? &_rangeSlopes[sampleIndex] : nullptr);
+			}
+			return lastIndex + 1;
+		}
+
+		//----------------------------------------------------------------------------------------
+		/// Samples a part of the direct range. Samples that can't be evaluated within the budget
+		/// are interpolated from the finest built level, and marked as pending.
+		/// @brief Samples a part of the direct range.
+		/// @param[in] splineData				The curve
+		/// @param[in] firstIndex				First sample to update
+		/// @param[in] lastIndex				Last sample to update
+		/// @param[in] budget						Time budget for evaluating the curve
+		//----------------------------------------------------------------------------------------
+		void SampleDirectRange(SplineData *splineData, Int firstIndex, Int lastIndex, const SplineDataSamplingBudget &budget)
+		{
+			const Int stopIndex = EvaluateDirectRange(splineData, firstIndex, lastIndex, budget);
+			if (stopIndex <= lastIndex)
+			{
+				InterpolateLevel(_levelCount - 1, _rangeStart, (_rangeEnd - _rangeStart) / (Float)(_rangeValues.GetCount() - 1), _rangeValues.GetFirst(), _slopes ? _rangeSlopes.GetFirst() : nullptr, stopIndex, lastIndex);
+				_rangePending.Add(stopIndex, lastIndex);
+			}
+		}
+
+		/// \brief Samples the part of the direct range that lies in the x interval from xStart to xEnd again
+		void UpdateDirectRange(SplineData *splineData, Float xStart, Float xEnd, const SplineDataSamplingBudget &budget)
+		{
+			if (_rangeValues.GetCount() < 2 || xEnd < _rangeStart || xStart > _rangeEnd)
+				return;
+
+			// Map the interval to the direct range
+			const Float rangeScale = 1.0 / (_rangeEnd - _rangeStart);
+			Int firstIndex = 0;
+			Int lastIndex = 0;
+			if (GetSampleIndexRange(Max(xStart - _rangeStart, 0.0) * rangeScale, Min(xEnd - _rangeStart, _rangeEnd - _rangeStart) * rangeScale, _rangeValues.GetCount(), firstIndex, lastIndex))
+				SampleDirectRange(splineData, firstIndex, lastIndex, budget);
+		}
+
+		maxon::BaseArray<Float32> _levels[MAX_LEVELS];
+		maxon::BaseArray<Float32> _levelSlopes[MAX_LEVELS]; ///< Slopes of the samples of each level, if slopes are kept
+		SplineDataPendingRange _pending[MAX_LEVELS]; ///< Samples of each level that still have to be evaluated
+		maxon::BaseArray<Float32> _rangeValues;      ///< Samples of the last range that was sampled directly
+		maxon::BaseArray<Float32> _rangeSlopes;      ///< Slopes of the samples of the direct range, if slopes are kept
+		Float _rangeStart = 0.0;                     ///< Start of the direct range
+		Float _rangeEnd = 0.0;                       ///< End of the direct range
+		SplineDataPendingRange _rangePending;        ///< Samples of the direct range that still have to be evaluated
+		SplineDataKnotSnapshot _knots;
+		Int32 _levelCount = 0;
+		UInt32 _baseSamples = 0;
+		UInt64 _hash = 0;
+		Bool _slopes = false;                        ///< True if the slopes of the samples are kept
+	};
+}
+
+#endif // SAMPLING_H__
@@ -0,0 +1,161 @@
+// Includes from API
+#include "c4d_baseobject.h"
+#include "c4d_includes.h"
+#include "c4d_messageplugin.h"
+#include "c4d_scenehookdata.h"
+#include "maxon/parallelfor.h"
+
+// Includes from plugin project
+#include "c4d_symbols.h"
+#include "main.h"
+
+// Local resources
+#include "c4d_resource.h"
+
+// Common values
+#include "commons.h"
+#include "regenerationjob.h"
+
+
+namespace SplineDataVisualizationHelpers
+{
+	//----------------------------------------------------------------------------------------
+	/// A chart generator whose contour has to be rebuilt
+	//----------------------------------------------------------------------------------------
+	struct SplineDataRegenerationEntry
+	{
+		BaseObject *op;
+		SplineDataRegenerationJob *job;
+		UInt32 dirty; ///< Data dirty count of the generator
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Collects all enabled chart generators in a hierarchy whose contour is outdated.
+	/// @brief Collects all outdated chart generators in a hierarchy.
+	/// @param[in] op									First object of the hierarchy
+	/// @param[out] entries						Array the generators are appended to
+	/// @return												OK on success
+	//----------------------------------------------------------------------------------------
+	static maxon::Result<void> CollectOutdatedGenerators(BaseObject *op, maxon::BaseArray<SplineDataRegenerationEntry> &entries)
+	{
+		iferr_scope;
+
+		for (; op; op = op->GetNext())
+		{
+			const Int32 type = op->GetType();
+			if ((type == ID_OBJECTDATA_SPLINEDATASPLINE || type == ID_OBJECTDATA_SPLINEDATAAXISSPLINE || type == ID_OBJECTDATA_SPLINEDATACHART) && op->GetDeformMode())
+			{
+				SplineDataRegenerationJobMessage jobMessage;
+				if (op->Message(MSG_SPLINEDATA_GETREGENERATIONJOB, &jobMessage) && jobMessage.job && jobMessage.job->IsOutdated(*op))
+					entries.Append(SplineDataRegenerationEntry{ op, jobMessage.job, op->GetDirty(DIRTYFLAGS::DATA) }) iferr_return;
+			}
+
+			CollectOutdatedGenerators(op->GetDown(), entries) iferr_return;
+		}
+
+		return maxon::OK;
+	}
+}
+
+
+//------------------------------------------------------------------------------------------------
+/// SceneHookData implementation that rebuilds the contours of all outdated chart generators
+/// of a document in one parallel pass, right before the generators are evaluated.
+/// When many charts depend on a shared parameter, they are not rebuilt one after another.
+//------------------------------------------------------------------------------------------------
+class SplineDataRegenerationScheduler : public SceneHookData
+{
+	INSTANCEOF(SplineDataRegenerationScheduler, SceneHookData)
+
+public:
+	virtual Bool AddToExecution(BaseSceneHook* node, PriorityList* list);
+	virtual EXECUTIONRESULT Execute(BaseSceneHook* node, BaseDocument* doc, BaseThread* bt, Int32 priority, EXECUTIONFLAGS flags);
+
+	static NodeData* Alloc()
+	{
+		return NewObj(SplineDataRegenerationScheduler) iferr_ignore("SplineDataRegenerationScheduler plugin not instanced");
+	}
+
+private:
+	maxon::BaseArray<SplineDataVisualizationHelpers::SplineDataRegenerationEntry> _entries; ///< Outdated generators, reused between passes
+};
+
+Bool SplineDataRegenerationScheduler::AddToExecution(BaseSceneHook* node, PriorityList* list)
+{
+	if (!list)
+		return false;
+
+	// Run after expressions (e.g. XPresso) have set the generators' parameters
+	list->Add(node, EXECUTIONPRIORITY_GENERATOR, EXECUTIONFLAGS::NONE);
+	return true;
+}
+
+EXECUTIONRESULT SplineDataRegenerationScheduler::Execute(BaseSceneHook* node, BaseDocument* doc, BaseThread* bt, Int32 priority, EXECUTIONFLAGS flags)
+{
+	if (!doc)
+		return EXECUTIONRESULT::OK;
+
+	// Collect outdated generators
+	_entries.Flush();
+	iferr (SplineDataVisualizationHelpers::CollectOutdatedGenerators(doc->GetFirstObject(), _entries))
+	{
+		DiagnosticOutput("Error on collecting chart generators: @", err);
+		return EXECUTIONRESULT::OUTOFMEMORY;
+	}
+
+	// A single generator is built in its own GetContour() call
+	if (_entries.GetCount() < 2)
+		return EXECUTIONRESULT::OK;
+
+	// Build all contours in parallel, each job only accesses its own generator
+	maxon::ParallelFor::Dynamic(0, _entries.GetCount(),
+		[this, bt](Int entryIndex)
+		{
+			const SplineDataVisualizationHelpers::SplineDataRegenerationEntry &entry = _entries[entryIndex];
+			entry.job->Precompute(*entry.op, entry.dirty, bt);
+		});
+
+	return EXECUTIONRESULT::OK;
+}
+
+
+//------------------------------------------------------------------------------------------------
+/// MessageData implementation that starts another evaluation of the active document when a
+/// generator could not finish sampling within its time budget. Generators request it from
+/// their evaluation thread with RequestSplineDataRefinement(), so refinement continues
+/// without any user interaction.
+//------------------------------------------------------------------------------------------------
+class SplineDataRefinementTrigger : public MessageData
+{
+public:
+	virtual Bool CoreMessage(Int32 id, const BaseContainer& bc);
+};
+
+Bool SplineDataRefinementTrigger::CoreMessage(Int32 id, const BaseContainer& bc)
+{
+	if (id == SplineDataVisualizationHelpers::ID_MESSAGEDATA_SPLINEDATAREFINEMENT)
+		EventAdd();
+
+	return true;
+}
+
+
+Bool RegisterRegenerationScheduler()
+{
+	String registeredName = GeLoadString(IDS_SCENEHOOK_REGENERATIONSCHEDULER);
+	if (!registeredName.IsPopulated())
+		return false;
+
+	if (!RegisterSceneHookPlugin(SplineDataVisualizationHelpers::ID_SCENEHOOK_REGENERATIONSCHEDULER, registeredName, 0, SplineDataRegenerationScheduler::Alloc, 0, 0))
+		return false;
+
+	String refinementName = GeLoadString(IDS_MESSAGEDATA_SPLINEDATAREFINEMENT);
+	if (!refinementName.IsPopulated())
+		return false;
+
+	SplineDataRefinementTrigger *refinementTrigger = NewObj(SplineDataRefinementTrigger) iferr_ignore("SplineDataRefinementTrigger plugin not instanced");
+	if (!refinementTrigger)
+		return false;
+
+	return RegisterMessagePlugin(SplineDataVisualizationHelpers::ID_MESSAGEDATA_SPLINEDATAREFINEMENT, refinementName, 0, refinementTrigger);
+}
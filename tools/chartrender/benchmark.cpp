@@ -0,0 +1,216 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "chartdefinition.h"
+#include "core/curvelayout.h"
+
+
+namespace SplineDataChartRender
+{
+	/// \brief Point type with the layout of the plugin's Vector, the curve kernels are benchmarked with the plugin's types
+	struct BenchmarkPoint
+	{
+		double x;
+		double y;
+		double z;
+
+		BenchmarkPoint() : x(0.0), y(0.0), z(0.0)
+		{
+		}
+
+		BenchmarkPoint(double _x, double _y, double _z) : x(_x), y(_y), z(_z)
+		{
+		}
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// The generic curve and overlay loop the specialized kernels replaced. It checks the
+	/// blend and the overlays for every point, and is kept as the benchmark's reference.
+	//----------------------------------------------------------------------------------------
+	template <typename TRANSFORM, typename VECTOR, typename VALUE>
+	static void WriteCurvePointsGeneric(VECTOR *points, const SplineDataVisualizationHelpers::SplineDataCurveOverlays<VECTOR> &overlays, const VALUE *valuesA, const VALUE *valuesB, double blend, int64_t count, double xStep, const SplineDataVisualizationHelpers::ScaleMapping &scale)
+	{
+		if (count <= 0)
+			return;
+
+		const double inverseSpacing = overlays.sampleSpacing > 0.0 ? 1.0 / overlays.sampleSpacing : 0.0;
+		const double halfSpacing = overlays.sampleSpacing * 0.5;
+		double previousValue = (double)valuesA[0] + ((double)valuesB[0] - (double)valuesA[0]) * blend;
+		double value = previousValue;
+		double integral = 0.0;
+		for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+		{
+			const bool hasNext = pointIndex + 1 < count;
+			const double nextValue = hasNext ? (double)valuesA[pointIndex + 1] + ((double)valuesB[pointIndex + 1] - (double)valuesA[pointIndex + 1]) * blend : value;
+			const double x = (double)pointIndex * xStep;
+			points[pointIndex] = VECTOR(x, scale.MapWith<TRANSFORM>(value), 0.0);
+
+			if (overlays.derivativePoints)
+			{
+				const double intervals = (double)((pointIndex > 0 ? 1 : 0) + (hasNext ? 1 : 0));
+				const double derivative = intervals > 0.0 ? (nextValue - previousValue) * inverseSpacing / intervals : 0.0;
+				overlays.derivativePoints[pointIndex] = VECTOR(x, derivative * overlays.derivativeHeight, 0.0);
+			}
+
+			if (overlays.integralPoints)
+			{
+				if (pointIndex > 0)
+					integral += (previousValue + value) * halfSpacing;
+				overlays.integralPoints[pointIndex] = VECTOR(x, integral * overlays.integralHeight, 0.0);
+			}
+
+			previousValue = value;
+			value = nextValue;
+		}
+	}
+
+	/// \brief Runs func repetitions times and returns the fastest run in microseconds
+	template <typename FUNC>
+	static double MeasureMicroseconds(int32_t repetitions, FUNC &&func)
+	{
+		double best = 0.0;
+		for (int32_t repetition = 0; repetition < repetitions; ++repetition)
+		{
+			const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			func();
+			const double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+			if (repetition == 0 || microseconds < best)
+				best = microseconds;
+		}
+		return best;
+	}
+
+	/// \brief Returns the difference between two values, relative to their magnitude if it is larger than 1.0
+	static double GetDifference(double a, double b)
+	{
+		return std::abs(a - b) / std::max(1.0, std::abs(a));
+	}
+
+	/// \brief Prints one result line
+	static void PrintResult(std::ostream &stream, const char *name, double genericMicroseconds, double specializedMicroseconds, double difference)
+	{
+		char line[256];
+		std::snprintf(line, sizeof(line), "%-42s generic %9.2f us   specialized %9.2f us   %6.2fx   max diff %.1e",
+			name, genericMicroseconds, specializedMicroseconds, specializedMicroseconds > 0.0 ? genericMicroseconds / specializedMicroseconds : 0.0, difference);
+		stream << line << std::endl;
+	}
+
+	/// \brief Benchmarks KnotCurve::Sample() against evaluating each sample position
+	static double BenchmarkKnotSampling(std::ostream &stream, const char *name, INTERPOLATION interpolation, int64_t sampleCount, int32_t repetitions)
+	{
+		// Uneven knot spacing, so the intervals hold different numbers of samples
+		ChartCurve curve;
+		curve.interpolation = interpolation;
+		const int32_t knotCount = 64;
+		for (int32_t knotIndex = 0; knotIndex < knotCount; ++knotIndex)
+		{
+			const double u = (double)knotIndex / (double)(knotCount - 1);
+			curve.knotX.push_back(u * u * 0.9 + u * 0.1);
+			curve.knotY.push_back(0.5 + 0.4 * std::sin(u * 17.0) * std::cos(u * 5.0));
+		}
+		const KnotCurve knotCurve(curve);
+
+		std::vector<double> genericValues((size_t)sampleCount);
+		std::vector<double> specializedValues((size_t)sampleCount);
+		const double step = 1.0 / (double)(sampleCount - 1);
+		const double genericMicroseconds = MeasureMicroseconds(repetitions, [&]()
+		{
+			for (int64_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+				genericValues[(size_t)sampleIndex] = knotCurve.Evaluate((double)sampleIndex * step);
+		});
+		const double specializedMicroseconds = MeasureMicroseconds(repetitions, [&]()
+		{
+			knotCurve.Sample(specializedValues.data(), 0, sampleCount, sampleCount);
+		});
+
+		double difference = 0.0;
+		for (size_t sampleIndex = 0; sampleIndex < genericValues.size(); ++sampleIndex)
+			difference = std::max(difference, GetDifference(genericValues[sampleIndex], specializedValues[sampleIndex]));
+
+		PrintResult(stream, name, genericMicroseconds, specializedMicroseconds, difference);
+		return difference;
+	}
+
+	/// \brief Benchmarks the curve kernel for one combination of settings against the generic loop
+	template <typename TRANSFORM>
+	static double BenchmarkCurveKernel(std::ostream &stream, const char *name, SplineDataVisualizationHelpers::SCALETYPE scaleType, bool blend, bool derivative, bool integral, int64_t sampleCount, int32_t repetitions)
+	{
+		using namespace SplineDataVisualizationHelpers;
+
+		// Samples in single precision, like the plugin's sample caches
+		std::vector<float> valuesA((size_t)sampleCount);
+		std::vector<float> valuesB((size_t)sampleCount);
+		for (size_t sampleIndex = 0; sampleIndex < valuesA.size(); ++sampleIndex)
+		{
+			const double x = (double)sampleIndex / (double)(sampleCount - 1);
+			valuesA[sampleIndex] = (float)(0.5 + 0.4 * std::sin(x * 40.0));
+			valuesB[sampleIndex] = (float)(0.5 + 0.4 * std::cos(x * 25.0));
+		}
+
+		const ScaleMapping scale(scaleType, 0.01, 1.0, 50.0);
+		const double xStep = 200.0 / (double)(sampleCount - 1);
+		const double blendFactor = blend ? 0.3 : 0.0;
+		const size_t pointCount = (size_t)sampleCount;
+
+		// The generic loop blends with itself without a morph target, like the plugin did
+		std::vector<BenchmarkPoint> genericPoints(pointCount * 3);
+		SplineDataCurveOverlays<BenchmarkPoint> genericOverlays;
+		genericOverlays.derivativePoints = derivative ? genericPoints.data() + pointCount : nullptr;
+		genericOverlays.integralPoints = integral ? genericPoints.data() + pointCount * 2 : nullptr;
+		genericOverlays.sampleSpacing = 1.0 / (double)(sampleCount - 1);
+		genericOverlays.derivativeHeight = 50.0;
+		genericOverlays.integralHeight = 50.0;
+		const float *genericValuesB = blend ? valuesB.data() : valuesA.data();
+		const double genericMicroseconds = MeasureMicroseconds(repetitions, [&]()
+		{
+			WriteCurvePointsGeneric<TRANSFORM>(genericPoints.data(), genericOverlays, valuesA.data(), genericValuesB, blendFactor, sampleCount, xStep, scale);
+		});
+
+		std::vector<BenchmarkPoint> specializedPoints(pointCount * 3);
+		SplineDataCurveOverlays<BenchmarkPoint> specializedOverlays = genericOverlays;
+		specializedOverlays.derivativePoints = derivative ? specializedPoints.data() + pointCount : nullptr;
+		specializedOverlays.integralPoints = integral ? specializedPoints.data() + pointCount * 2 : nullptr;
+		const double specializedMicroseconds = MeasureMicroseconds(repetitions, [&]()
+		{
+			WriteSplineDataCurvePoints(specializedPoints.data(), specializedOverlays, valuesA.data(), blend ? valuesB.data() : nullptr, blendFactor, sampleCount, 0.0, xStep, scale);
+		});
+
+		double difference = 0.0;
+		for (size_t pointIndex = 0; pointIndex < genericPoints.size(); ++pointIndex)
+		{
+			difference = std::max(difference, GetDifference(genericPoints[pointIndex].x, specializedPoints[pointIndex].x));
+			difference = std::max(difference, GetDifference(genericPoints[pointIndex].y, specializedPoints[pointIndex].y));
+		}
+
+		PrintResult(stream, name, genericMicroseconds, specializedMicroseconds, difference);
+		return difference;
+	}
+
+	bool RunBenchmarks(std::ostream &stream, int64_t sampleCount, int32_t repetitions)
+	{
+		using namespace SplineDataVisualizationHelpers;
+
+		// Results may differ in the last bits, as the kernels factor some computations out of the loops
+		const double tolerance = 1e-9;
+		if (sampleCount < 2 || repetitions < 1)
+			return false;
+
+		stream << "Samples: " << sampleCount << ", fastest of " << repetitions << " runs" << std::endl;
+
+		double difference = 0.0;
+		difference = std::max(difference, BenchmarkKnotSampling(stream, "sample linear", INTERPOLATION::LINEAR, sampleCount, repetitions));
+		difference = std::max(difference, BenchmarkKnotSampling(stream, "sample smooth", INTERPOLATION::SMOOTH, sampleCount, repetitions));
+		difference = std::max(difference, BenchmarkCurveKernel<ScaleTransformLinear>(stream, "curve linear", SCALETYPE::LINEAR, false, false, false, sampleCount, repetitions));
+		difference = std::max(difference, BenchmarkCurveKernel<ScaleTransformLinear>(stream, "curve linear, morph", SCALETYPE::LINEAR, true, false, false, sampleCount, repetitions));
+		difference = std::max(difference, BenchmarkCurveKernel<ScaleTransformLinear>(stream, "curve linear, derivative, integral", SCALETYPE::LINEAR, false, true, true, sampleCount, repetitions));
+		difference = std::max(difference, BenchmarkCurveKernel<ScaleTransformLinear>(stream, "curve linear, morph, derivative, integral", SCALETYPE::LINEAR, true, true, true, sampleCount, repetitions));
+		difference = std::max(difference, BenchmarkCurveKernel<ScaleTransformLog10>(stream, "curve log10, derivative", SCALETYPE::LOG10, false, true, false, sampleCount, repetitions));
+
+		return difference <= tolerance;
+	}
+}
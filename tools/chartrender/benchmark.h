@@ -0,0 +1,23 @@
+#ifndef BENCHMARK_H__
+#define BENCHMARK_H__
+
+#include <cstdint>
+#include <ostream>
+
+
+namespace SplineDataChartRender
+{
+	//----------------------------------------------------------------------------------------
+	/// Measures the specialized sampling and curve kernels against the generic per-point
+	/// loops they replaced, and prints one line per case with both timings, the speedup and
+	/// the largest difference between the results.
+	/// @brief Benchmarks the specialized sampling and curve kernels.
+	/// @param[out] stream						Output stream for the results
+	/// @param[in] sampleCount				Number of samples per run
+	/// @param[in] repetitions				Number of runs per case, the fastest run is reported
+	/// @return												True if all kernels match the generic loops
+	//----------------------------------------------------------------------------------------
+	bool RunBenchmarks(std::ostream &stream, int64_t sampleCount, int32_t repetitions);
+}
+
+#endif // BENCHMARK_H__
@@ -0,0 +1,337 @@
+#include "chartdefinition.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+
+
+namespace SplineDataChartRender
+{
+	/// \brief Writes the samples of one knot interval, specialized for the interpolation
+	template <INTERPOLATION MODE>
+	struct KnotIntervalKernel;
+
+	template <>
+	struct KnotIntervalKernel<INTERPOLATION::LINEAR>
+	{
+		static void Write(double *values, int64_t first, int64_t end, double tScale, double tOffset, double, double y0, double y1, double, double)
+		{
+			const double slope = y1 - y0;
+			for (int64_t sampleIndex = first; sampleIndex < end; ++sampleIndex)
+				values[sampleIndex] = y0 + slope * ((double)sampleIndex * tScale + tOffset);
+		}
+	};
+
+	template <>
+	struct KnotIntervalKernel<INTERPOLATION::SMOOTH>
+	{
+		static void Write(double *values, int64_t first, int64_t end, double tScale, double tOffset, double dx, double y0, double y1, double tangent0, double tangent1)
+		{
+			// Cubic Hermite basis, the tangents are scaled to the interval once
+			const double m0 = tangent0 * dx;
+			const double m1 = tangent1 * dx;
+			for (int64_t sampleIndex = first; sampleIndex < end; ++sampleIndex)
+			{
+				const double t = (double)sampleIndex * tScale + tOffset;
+				const double t2 = t * t;
+				const double t3 = t2 * t;
+				const double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+				const double h10 = t3 - 2.0 * t2 + t;
+				const double h01 = -2.0 * t3 + 3.0 * t2;
+				const double h11 = t3 - t2;
+				values[sampleIndex] = h00 * y0 + h10 * m0 + h01 * y1 + h11 * m1;
+			}
+		}
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Samples a curve like KnotCurve::Evaluate() at each position, but walks the knot
+	/// intervals in order instead of searching the interval of each sample.
+	/// @brief Samples a curve with a specialized interpolation.
+	/// @param[in] curve							The curve
+	/// @param[in] tangents						The knot tangents, only used by smooth interpolation
+	/// @param[out] values						Array receiving count samples
+	/// @param[in] firstIndex					Index of the first sample
+	/// @param[in] count							Number of samples
+	/// @param[in] sampleCount				Number of samples over 0.0 - 1.0
+	//----------------------------------------------------------------------------------------
+	template <INTERPOLATION MODE>
+	static void SampleKnotCurve(const ChartCurve &curve, const std::vector<double> &tangents, double *values, int64_t firstIndex, int64_t count, int64_t sampleCount)
+	{
+		const std::vector<double> &knotX = curve.knotX;
+		const std::vector<double> &knotY = curve.knotY;
+		if (knotX.empty())
+		{
+			std::fill(values, values + count, 0.0);
+			return;
+		}
+
+		const double step = sampleCount > 1 ? 1.0 / (double)(sampleCount - 1) : 0.0;
+		auto position = [&](int64_t sampleIndex) { return (double)(firstIndex + sampleIndex) * step; };
+
+		// Clamped before the first knot
+		int64_t sampleIndex = 0;
+		while (sampleIndex < count && position(sampleIndex) <= knotX.front())
+			values[sampleIndex++] = knotY.front();
+
+		// Each interval covers the samples up to, but not including, its end knot
+		for (size_t next = 1; next < knotX.size() && sampleIndex < count; ++next)
+		{
+			int64_t endIndex = sampleIndex;
+			while (endIndex < count && position(endIndex) < knotX[next])
+				++endIndex;
+
+			// The interval parameter t of a sample is sampleIndex * tScale + tOffset
+			const size_t prev = next - 1;
+			if (endIndex > sampleIndex)
+			{
+				const double dx = knotX[next] - knotX[prev];
+				const double tScale = step / dx;
+				const double tOffset = ((double)firstIndex * step - knotX[prev]) / dx;
+				KnotIntervalKernel<MODE>::Write(values, sampleIndex, endIndex, tScale, tOffset, dx, knotY[prev], knotY[next], tangents[prev], tangents[next]);
+			}
+			sampleIndex = endIndex;
+		}
+
+		// Clamped after the last knot
+		for (; sampleIndex < count; ++sampleIndex)
+			values[sampleIndex] = knotY.back();
+	}
+
+	KnotCurve::KnotCurve(const ChartCurve &curve) : _curve(curve)
+	{
+		// One sampler per interpolation, indexed by INTERPOLATION
+		static const Sampler samplers[] =
+		{
+			&SampleKnotCurve<INTERPOLATION::LINEAR>,
+			&SampleKnotCurve<INTERPOLATION::SMOOTH>
+		};
+		_sampler = samplers[(size_t)_curve.interpolation];
+
+		// Catmull-Rom tangents from the neighboring knots, one-sided at the ends
+		const size_t knotCount = _curve.knotX.size();
+		_tangents.resize(knotCount, 0.0);
+		if (_curve.interpolation != INTERPOLATION::SMOOTH || knotCount < 2)
+			return;
+
+		for (size_t knotIndex = 0; knotIndex < knotCount; ++knotIndex)
+		{
+			const size_t prev = knotIndex > 0 ? knotIndex - 1 : knotIndex;
+			const size_t next = knotIndex + 1 < knotCount ? knotIndex + 1 : knotIndex;
+			const double dx = _curve.knotX[next] - _curve.knotX[prev];
+			_tangents[knotIndex] = dx > 0.0 ? (_curve.knotY[next] - _curve.knotY[prev]) / dx : 0.0;
+		}
+	}
+
+	double KnotCurve::Evaluate(double x) const
+	{
+		const std::vector<double> &knotX = _curve.knotX;
+		const std::vector<double> &knotY = _curve.knotY;
+		if (knotX.empty())
+			return 0.0;
+		if (x <= knotX.front())
+			return knotY.front();
+		if (x >= knotX.back())
+			return knotY.back();
+
+		// Find the interval containing x
+		const size_t next = (size_t)(std::upper_bound(knotX.begin(), knotX.end(), x) - knotX.begin());
+		const size_t prev = next - 1;
+		const double dx = knotX[next] - knotX[prev];
+		if (dx <= 0.0)
+			return knotY[next];
+
+		const double t = (x - knotX[prev]) / dx;
+		if (_curve.interpolation == INTERPOLATION::LINEAR)
+			return knotY[prev] + (knotY[next] - knotY[prev]) * t;
+
+		// Cubic Hermite basis
+		const double t2 = t * t;
+		const double t3 = t2 * t;
+		const double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+		const double h10 = t3 - 2.0 * t2 + t;
+		const double h01 = -2.0 * t3 + 3.0 * t2;
+		const double h11 = t3 - t2;
+		return h00 * knotY[prev] + h10 * dx * _tangents[prev] + h01 * knotY[next] + h11 * dx * _tangents[next];
+	}
+
+	void KnotCurve::Sample(double *values, int64_t firstIndex, int64_t count, int64_t sampleCount) const
+	{
+		_sampler(_curve, _tangents, values, firstIndex, count, sampleCount);
+	}
+
+	/// \brief Returns true if a color can be written into an SVG attribute as is, e.g. "#d04020" or "steelblue"
+	static bool IsValidColor(const std::string &color)
+	{
+		if (color.empty())
+			return false;
+		for (const char character : color)
+		{
+			if (!std::isalnum((unsigned char)character) && character != '#' && character != '(' && character != ')' && character != ',' && character != '.' && character != '%')
+				return false;
+		}
+		return true;
+	}
+
+	/// \brief Sorts the knots of a curve by x
+	static void SortKnots(ChartCurve &curve)
+	{
+		std::vector<size_t> order(curve.knotX.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&curve](size_t a, size_t b) { return curve.knotX[a] < curve.knotX[b]; });
+
+		std::vector<double> knotX(order.size());
+		std::vector<double> knotY(order.size());
+		for (size_t index = 0; index < order.size(); ++index)
+		{
+			knotX[index] = curve.knotX[order[index]];
+			knotY[index] = curve.knotY[order[index]];
+		}
+		curve.knotX.swap(knotX);
+		curve.knotY.swap(knotY);
+	}
+
+	bool ParseChartDefinition(std::istream &stream, ChartDefinition &chart, std::string &error)
+	{
+		using SplineDataVisualizationHelpers::SCALETYPE;
+
+		std::string line;
+		int32_t lineNumber = 0;
+		while (std::getline(stream, line))
+		{
+			++lineNumber;
+
+			// Skip empty lines and comments; comments are whole lines, as colors may contain '#'
+			std::istringstream lineStream(line);
+			std::string key;
+			if (!(lineStream >> key) || key[0] == '#')
+				continue;
+
+			auto fail = [&error, lineNumber, &key](const char *message)
+			{
+				error = "line " + std::to_string(lineNumber) + " (" + key + "): " + message;
+				return false;
+			};
+
+			// Typed value readers
+			auto readFloat = [&lineStream](double &value) { return (bool)(lineStream >> value); };
+			auto readBool = [&lineStream](bool &value)
+			{
+				int32_t intValue = 0;
+				if (!(lineStream >> intValue))
+					return false;
+				value = intValue != 0;
+				return true;
+			};
+
+			bool ok = true;
+			if (key == "width")
+				ok = readFloat(chart.width) && std::isfinite(chart.width);
+			else if (key == "height")
+				ok = readFloat(chart.height) && std::isfinite(chart.height);
+			else if (key == "subdivision")
+				ok = (bool)(lineStream >> chart.subdivision) && chart.subdivision >= MIN_CHART_SUBDIVISION && chart.subdivision <= MAX_CHART_SUBDIVISION;
+			else if (key == "scale")
+			{
+				std::string scaleName;
+				ok = (bool)(lineStream >> scaleName);
+				if (scaleName == "linear")
+					chart.scale = SCALETYPE::LINEAR;
+				else if (scaleName == "log10")
+					chart.scale = SCALETYPE::LOG10;
+				else if (scaleName == "symlog")
+					chart.scale = SCALETYPE::SYMLOG;
+				else
+					ok = false;
+			}
+			else if (key == "scalemin")
+				ok = readFloat(chart.scaleMin);
+			else if (key == "scalemax")
+				ok = readFloat(chart.scaleMax);
+			else if (key == "axis")
+				ok = readBool(chart.axis);
+			else if (key == "overshoot")
+				ok = readFloat(chart.overshoot);
+			else if (key == "arrows")
+				ok = readBool(chart.arrows);
+			else if (key == "arrowheight")
+				ok = readFloat(chart.arrowHeight);
+			else if (key == "arrowwidth")
+				ok = readFloat(chart.arrowWidth);
+			else if (key == "arrowovershoot")
+				ok = readFloat(chart.arrowOvershoot);
+			else if (key == "ticks")
+				ok = readBool(chart.ticks);
+			else if (key == "tickspacingx")
+				ok = readFloat(chart.tickSpacingX);
+			else if (key == "tickspacingy")
+				ok = readFloat(chart.tickSpacingY);
+			else if (key == "minorticks")
+				ok = (bool)(lineStream >> chart.tickMinorSubdivision) && chart.tickMinorSubdivision >= 1;
+			else if (key == "majorticklength")
+				ok = readFloat(chart.tickMajorLength);
+			else if (key == "minorticklength")
+				ok = readFloat(chart.tickMinorLength);
+			else if (key == "grid")
+				ok = readBool(chart.grid);
+			else if (key == "axiscolor")
+				ok = (bool)(lineStream >> chart.axisColor) && IsValidColor(chart.axisColor);
+			else if (key == "axisstroke")
+				ok = readFloat(chart.axisStrokeWidth);
+			else if (key == "curve")
+			{
+				chart.curves.emplace_back();
+				std::string interpolationName;
+				if (lineStream >> interpolationName)
+				{
+					if (interpolationName == "linear")
+						chart.curves.back().interpolation = INTERPOLATION::LINEAR;
+					else if (interpolationName == "smooth")
+						chart.curves.back().interpolation = INTERPOLATION::SMOOTH;
+					else
+						ok = false;
+				}
+			}
+			else if (key == "color" || key == "stroke" || key == "knot")
+			{
+				if (chart.curves.empty())
+					return fail("must follow a curve");
+
+				ChartCurve &curve = chart.curves.back();
+				if (key == "color")
+					ok = (bool)(lineStream >> curve.color) && IsValidColor(curve.color);
+				else if (key == "stroke")
+					ok = readFloat(curve.strokeWidth);
+				else
+				{
+					double x = 0.0;
+					double y = 0.0;
+					ok = readFloat(x) && readFloat(y);
+					curve.knotX.push_back(x);
+					curve.knotY.push_back(y);
+				}
+			}
+			else
+			{
+				return fail("unknown key");
+			}
+
+			if (!ok)
+				return fail("invalid value");
+		}
+
+		for (ChartCurve &curve : chart.curves)
+		{
+			if (curve.knotX.empty())
+			{
+				error = "curve without knots";
+				return false;
+			}
+			SortKnots(curve);
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,109 @@
+#ifndef CHARTDEFINITION_H__
+#define CHARTDEFINITION_H__
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "core/scalemapping.h"
+
+
+namespace SplineDataChartRender
+{
+	// Subdivision limits, the same as for the SplineData objects
+	static const uint32_t MIN_CHART_SUBDIVISION = 2;
+	static const uint32_t MAX_CHART_SUBDIVISION = 1000;
+
+	/// \brief Interpolation between the knots of a curve
+	enum class INTERPOLATION
+	{
+		LINEAR,
+		SMOOTH
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// A curve defined by knots, the command line counterpart of a SplineData.
+	/// Knots are sorted by x, x is expected in the range 0.0 - 1.0.
+	//----------------------------------------------------------------------------------------
+	struct ChartCurve
+	{
+		INTERPOLATION interpolation = INTERPOLATION::SMOOTH;
+		std::vector<double> knotX;
+		std::vector<double> knotY;
+		std::string color = "#000000";
+		double strokeWidth = 1.0;
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Evaluates a ChartCurve. Smooth curves use cubic Hermite interpolation with
+	/// Catmull-Rom tangents; values outside the knot range are clamped.
+	/// Sample() uses a sampler specialized for the curve's interpolation, chosen once on
+	/// construction. It walks the knot intervals in order, so the loop over the samples of
+	/// an interval neither searches nor branches.
+	//----------------------------------------------------------------------------------------
+	class KnotCurve
+	{
+	public:
+		explicit KnotCurve(const ChartCurve &curve);
+
+		/// \brief Returns the curve's value at x
+		double Evaluate(double x) const;
+
+		/// \brief Samples the curve at count evenly spaced positions, starting at sample firstIndex of sampleCount samples over 0.0 - 1.0
+		void Sample(double *values, int64_t firstIndex, int64_t count, int64_t sampleCount) const;
+
+	private:
+		typedef void (*Sampler)(const ChartCurve &curve, const std::vector<double> &tangents, double *values, int64_t firstIndex, int64_t count, int64_t sampleCount);
+
+		const ChartCurve &_curve;
+		std::vector<double> _tangents;
+		Sampler _sampler;
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// All parameters of a chart: the same parameters as SplineData Spline and
+	/// SplineData Axis Spline objects, plus one or more curves.
+	//----------------------------------------------------------------------------------------
+	struct ChartDefinition
+	{
+		double width = 200.0;
+		double height = 50.0;
+		uint32_t subdivision = 100;
+		SplineDataVisualizationHelpers::SCALETYPE scale = SplineDataVisualizationHelpers::SCALETYPE::LINEAR;
+		double scaleMin = 0.0;
+		double scaleMax = 1.0;
+
+		bool axis = true;
+		double overshoot = 2.0;
+		bool arrows = true;
+		double arrowHeight = 5.0;
+		double arrowWidth = 5.0;
+		double arrowOvershoot = 10.0;
+		bool ticks = false;
+		double tickSpacingX = 50.0;
+		double tickSpacingY = 25.0;
+		int32_t tickMinorSubdivision = 5;
+		double tickMajorLength = 3.0;
+		double tickMinorLength = 1.5;
+		bool grid = false;
+		std::string axisColor = "#000000";
+		double axisStrokeWidth = 1.2;
+
+		std::vector<ChartCurve> curves;
+	};
+
+	//----------------------------------------------------------------------------------------
+	/// Parses a chart definition. The format is line based, one "key value" pair per line,
+	/// lines starting with "#" are comments. "curve [linear|smooth]" starts a new curve, "knot x y" adds a
+	/// knot to the current curve.
+	/// @brief Parses a chart definition.
+	/// @param[in] stream							Input stream
+	/// @param[out] chart							Receives the chart definition
+	/// @param[out] error							Receives an error message if parsing fails
+	/// @return												True on success
+	//----------------------------------------------------------------------------------------
+	bool ParseChartDefinition(std::istream &stream, ChartDefinition &chart, std::string &error);
+}
+
+#endif // CHARTDEFINITION_H__
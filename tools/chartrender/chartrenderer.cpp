@@ -0,0 +1,285 @@
+#include "chartrenderer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "core/axislayout.h"
+#include "core/curvelayout.h"
+
+
+namespace SplineDataChartRender
+{
+	// Number of curve samples processed at once
+	static const int64_t CURVE_CHUNK_SIZE = 4096;
+
+	// Empty space around the chart in the SVG
+	static const double SVG_MARGIN = 10.0;
+
+	// Output buffer size, the buffer is flushed to the stream when it grows beyond this
+	static const size_t OUTPUT_BUFFER_SIZE = 1 << 16;
+
+	/// \brief Point type for the shared layout code. Charts are planar, so only x and y are stored, in single precision.
+	struct ChartPoint
+	{
+		float x;
+		float y;
+
+		ChartPoint() : x(0.0f), y(0.0f)
+		{
+		}
+
+		ChartPoint(double _x, double _y, double) : x((float)_x), y((float)_y)
+		{
+		}
+	};
+
+	/// \brief Segment type for the shared layout code
+	struct ChartSegment
+	{
+		int32_t cnt;
+		bool closed;
+	};
+
+	/// \brief Buffers output and flushes it to a stream in large blocks
+	class OutputBuffer
+	{
+	public:
+		explicit OutputBuffer(std::ostream &stream) : _stream(stream)
+		{
+			_buffer.reserve(OUTPUT_BUFFER_SIZE + 256);
+		}
+
+		~OutputBuffer()
+		{
+			Flush();
+		}
+
+		void Append(const char *text)
+		{
+			_buffer.append(text);
+			FlushIfFull();
+		}
+
+		void Append(const std::string &text)
+		{
+			_buffer.append(text);
+			FlushIfFull();
+		}
+
+		void AppendBytes(const void *data, size_t size)
+		{
+			_buffer.append(static_cast<const char*>(data), size);
+			FlushIfFull();
+		}
+
+		/// \brief Appends a uint32 in little endian byte order, independent of the host
+		void AppendUInt32(uint32_t value)
+		{
+			const char bytes[4] = { (char)(value & 0xFF), (char)((value >> 8) & 0xFF), (char)((value >> 16) & 0xFF), (char)((value >> 24) & 0xFF) };
+			AppendBytes(bytes, sizeof(bytes));
+		}
+
+		/// \brief Appends a float32 in little endian byte order, independent of the host
+		void AppendFloat32(float value)
+		{
+			uint32_t bits = 0;
+			std::memcpy(&bits, &value, sizeof(bits));
+			AppendUInt32(bits);
+		}
+
+		/// \brief Appends a path command with a coordinate pair
+		void AppendPathCommand(char command, double x, double y)
+		{
+			char text[64];
+			const int length = std::snprintf(text, sizeof(text), "%c%.3f %.3f ", command, x, y);
+			if (length > 0)
+				_buffer.append(text, (size_t)std::min(length, (int)sizeof(text) - 1));
+			FlushIfFull();
+		}
+
+		bool Flush()
+		{
+			if (!_buffer.empty())
+			{
+				_stream.write(_buffer.data(), (std::streamsize)_buffer.size());
+				_buffer.clear();
+			}
+			return (bool)_stream;
+		}
+
+	private:
+		void FlushIfFull()
+		{
+			if (_buffer.size() >= OUTPUT_BUFFER_SIZE)
+				Flush();
+		}
+
+		std::ostream &_stream;
+		std::string _buffer;
+	};
+
+	/// \brief Returns a number formatted for SVG attributes
+	static std::string FormatNumber(double value)
+	{
+		char text[32];
+		std::snprintf(text, sizeof(text), "%.3f", value);
+		return text;
+	}
+
+	/// \brief Lays out the axis system of a chart, using the same code as the SplineData Axis Spline object
+	static void BuildAxisLayout(const ChartDefinition &chart, std::vector<ChartPoint> &points, std::vector<ChartSegment> &segments)
+	{
+		using namespace SplineDataVisualizationHelpers;
+
+		const ScaleMapping scaleY(chart.scale, chart.scaleMin, chart.scaleMax, chart.height);
+		const SplineDataAxisLayoutParameters params(chart.height, chart.width, chart.overshoot, chart.arrows, chart.arrowHeight, chart.arrowWidth, chart.arrowOvershoot,
+			chart.ticks, chart.tickSpacingX, chart.tickSpacingY, scaleY, chart.tickMinorSubdivision, chart.tickMajorLength, chart.tickMinorLength, chart.grid);
+
+		const SplineDataAxisTickLayout tickLayout = GetAxisTickLayout(params);
+		points.resize(GetNumberOfRequiredSplinePoints(params, tickLayout));
+		segments.resize(GetNumberOfRequiredSplineSegments(params, tickLayout));
+		WriteSplineDataAxisLayout(params, tickLayout, points.data(), segments.data());
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Samples a curve in chunks and calls chunkFunc for each chunk of mapped points.
+	/// Uses the same sampling loop and scale mapping as the SplineData Spline object.
+	/// @brief Samples a curve in chunks.
+	/// @param[in] chart							The chart definition
+	/// @param[in] curve							The curve to sample
+	/// @param[in] chunkFunc					Callable with signature void(const ChartPoint *points, int64_t firstIndex, int64_t count)
+	//----------------------------------------------------------------------------------------
+	template <typename FUNC>
+	static void ForEachCurveChunk(const ChartDefinition &chart, const ChartCurve &curve, FUNC &&chunkFunc)
+	{
+		using namespace SplineDataVisualizationHelpers;
+
+		const ScaleMapping scale(chart.scale, chart.scaleMin, chart.scaleMax, chart.height);
+		const KnotCurve knotCurve(curve);
+		const int64_t sampleCount = (int64_t)chart.subdivision + 1;
+		const double xStep = chart.width / (double)(sampleCount - 1);
+
+		const SplineDataCurveOverlays<ChartPoint> overlays;
+
+		std::vector<double> values((size_t)std::min(sampleCount, CURVE_CHUNK_SIZE));
+		std::vector<ChartPoint> points(values.size());
+		for (int64_t firstIndex = 0; firstIndex < sampleCount; firstIndex += CURVE_CHUNK_SIZE)
+		{
+			const int64_t count = std::min(CURVE_CHUNK_SIZE, sampleCount - firstIndex);
+			knotCurve.Sample(values.data(), firstIndex, count, sampleCount);
+			WriteSplineDataCurvePoints(points.data(), overlays, values.data(), (const double*)nullptr, 0.0, count, (double)firstIndex * xStep, xStep, scale);
+			chunkFunc(points.data(), firstIndex, count);
+		}
+	}
+
+	bool WriteChartSvg(const ChartDefinition &chart, std::ostream &stream)
+	{
+		OutputBuffer output(stream);
+
+		// Visible area; y is flipped, as SVG's y axis points downwards
+		double minX = 0.0;
+		double minY = 0.0;
+		double maxX = chart.width;
+		double maxY = chart.height;
+		if (chart.axis)
+		{
+			const double negativeExtent = std::max({ chart.overshoot, chart.tickMajorLength, chart.tickMinorLength, chart.arrows ? chart.arrowWidth * 0.5 : 0.0 });
+			const double arrowExtent = chart.arrowOvershoot + chart.arrowHeight * (chart.arrows ? 0.75 : 0.25);
+			minX = -negativeExtent;
+			minY = -negativeExtent;
+			maxX += arrowExtent;
+			maxY += arrowExtent;
+		}
+		minX -= SVG_MARGIN;
+		minY -= SVG_MARGIN;
+		maxX += SVG_MARGIN;
+		maxY += SVG_MARGIN;
+
+		const std::string svgWidth = FormatNumber(maxX - minX);
+		const std::string svgHeight = FormatNumber(maxY - minY);
+		output.Append("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+		output.Append("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" + svgWidth + "\" height=\"" + svgHeight + "\" viewBox=\"" + FormatNumber(minX) + " " + FormatNumber(-maxY) + " " + svgWidth + " " + svgHeight + "\">\n");
+		output.Append("<g transform=\"scale(1,-1)\" fill=\"none\" stroke-linecap=\"round\" stroke-linejoin=\"round\">\n");
+
+		// Axis system as one path
+		if (chart.axis)
+		{
+			std::vector<ChartPoint> points;
+			std::vector<ChartSegment> segments;
+			BuildAxisLayout(chart, points, segments);
+
+			output.Append("<path stroke=\"" + chart.axisColor + "\" stroke-width=\"" + FormatNumber(chart.axisStrokeWidth) + "\" d=\"");
+			size_t pointIndex = 0;
+			for (const ChartSegment &segment : segments)
+			{
+				for (int32_t segmentPointIndex = 0; segmentPointIndex < segment.cnt; ++segmentPointIndex, ++pointIndex)
+					output.AppendPathCommand(segmentPointIndex == 0 ? 'M' : 'L', points[pointIndex].x, points[pointIndex].y);
+				if (segment.closed)
+					output.Append("Z ");
+			}
+			output.Append("\"/>\n");
+		}
+
+		// One path per curve, streamed chunk by chunk
+		for (const ChartCurve &curve : chart.curves)
+		{
+			output.Append("<path stroke=\"" + curve.color + "\" stroke-width=\"" + FormatNumber(curve.strokeWidth) + "\" d=\"");
+			ForEachCurveChunk(chart, curve, [&output](const ChartPoint *points, int64_t firstIndex, int64_t count)
+			{
+				for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+					output.AppendPathCommand(firstIndex + pointIndex == 0 ? 'M' : 'L', points[pointIndex].x, points[pointIndex].y);
+			});
+			output.Append("\"/>\n");
+		}
+
+		output.Append("</g>\n</svg>\n");
+		return output.Flush();
+	}
+
+	bool WriteChartPolylines(const ChartDefinition &chart, std::ostream &stream)
+	{
+		OutputBuffer output(stream);
+
+		const uint32_t version = 1;
+		output.AppendBytes("SDVP", 4);
+		output.AppendUInt32(version);
+
+		auto appendPoint = [&output](const ChartPoint &point)
+		{
+			output.AppendFloat32(point.x);
+			output.AppendFloat32(point.y);
+		};
+
+		if (chart.axis)
+		{
+			std::vector<ChartPoint> points;
+			std::vector<ChartSegment> segments;
+			BuildAxisLayout(chart, points, segments);
+
+			size_t pointIndex = 0;
+			for (const ChartSegment &segment : segments)
+			{
+				const uint32_t pointCount = (uint32_t)segment.cnt;
+				output.AppendUInt32(pointCount);
+				for (uint32_t segmentPointIndex = 0; segmentPointIndex < pointCount; ++segmentPointIndex)
+					appendPoint(points[pointIndex++]);
+			}
+		}
+
+		for (const ChartCurve &curve : chart.curves)
+		{
+			const uint32_t pointCount = chart.subdivision + 1;
+			output.AppendUInt32(pointCount);
+			ForEachCurveChunk(chart, curve, [&appendPoint](const ChartPoint *points, int64_t, int64_t count)
+			{
+				for (int64_t pointIndex = 0; pointIndex < count; ++pointIndex)
+					appendPoint(points[pointIndex]);
+			});
+		}
+
+		return output.Flush();
+	}
+}
@@ -0,0 +1,36 @@
+#ifndef CHARTRENDERER_H__
+#define CHARTRENDERER_H__
+
+#include <ostream>
+
+#include "chartdefinition.h"
+
+
+namespace SplineDataChartRender
+{
+	//----------------------------------------------------------------------------------------
+	/// Renders a chart as SVG. Axes are laid out with the same code as the SplineData Axis
+	/// Spline object, curves are sampled and mapped with the same code as the SplineData
+	/// Spline object. Curve points are streamed in fixed-size chunks, so memory use does not
+	/// grow with the subdivision.
+	/// @brief Renders a chart as SVG.
+	/// @param[in] chart							The chart definition
+	/// @param[out] stream						Output stream
+	/// @return												True on success
+	//----------------------------------------------------------------------------------------
+	bool WriteChartSvg(const ChartDefinition &chart, std::ostream &stream);
+
+	//----------------------------------------------------------------------------------------
+	/// Writes the chart's polylines in a raw binary format: the magic "SDVP" and a uint32
+	/// version, followed by one record per polyline: a uint32 point count and the points as
+	/// float32 x/y pairs. Axis polylines come first, followed by one polyline per curve.
+	/// All values are little endian.
+	/// @brief Writes the chart's polylines in a raw binary format.
+	/// @param[in] chart							The chart definition
+	/// @param[out] stream						Output stream, opened in binary mode
+	/// @return												True on success
+	//----------------------------------------------------------------------------------------
+	bool WriteChartPolylines(const ChartDefinition &chart, std::ostream &stream);
+}
+
+#endif // CHARTRENDERER_H__
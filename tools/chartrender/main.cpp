@@ -0,0 +1,210 @@
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "chartdefinition.h"
+#include "chartrenderer.h"
+
+
+namespace
+{
+	// Benchmark settings, the spline objects sample at most 1000 subdivisions
+	const int64_t BENCHMARK_SAMPLES = 1001;
+	const int32_t BENCHMARK_REPETITIONS = 2000;
+
+	/// \brief Command line options
+	struct RenderOptions
+	{
+		std::vector<std::filesystem::path> inputFiles;
+		std::filesystem::path outputDirectory;
+		bool hasOutputDirectory = false;
+		bool writePolylines = false;
+		bool benchmark = false;
+		uint32_t threadCount = 0;
+	};
+
+	void PrintUsage()
+	{
+		std::cerr << "Usage: chartrender [--threads N] [--raw] [--output DIR] CHART..." << std::endl
+			<< "       chartrender --benchmark" << std::endl
+			<< "Renders chart definition files to SVG, one output file per input file." << std::endl
+			<< "  --threads N    Number of worker threads (default: number of cores)" << std::endl
+			<< "  --raw          Additionally write the polylines in raw binary format (.bin)" << std::endl
+			<< "  --output DIR   Write output files to DIR instead of next to the input files" << std::endl
+			<< "  --benchmark    Compare the specialized sampling kernels with the generic loops" << std::endl;
+	}
+
+	bool ParseArguments(int argc, char *argv[], RenderOptions &options)
+	{
+		for (int argIndex = 1; argIndex < argc; ++argIndex)
+		{
+			const std::string arg = argv[argIndex];
+			if (arg == "--threads" && argIndex + 1 < argc)
+			{
+				const int threadCount = std::atoi(argv[++argIndex]);
+				if (threadCount < 1)
+					return false;
+				options.threadCount = (uint32_t)threadCount;
+			}
+			else if (arg == "--raw")
+			{
+				options.writePolylines = true;
+			}
+			else if (arg == "--benchmark")
+			{
+				options.benchmark = true;
+			}
+			else if (arg == "--output" && argIndex + 1 < argc)
+			{
+				options.outputDirectory = argv[++argIndex];
+				options.hasOutputDirectory = true;
+			}
+			else if (!arg.empty() && arg[0] == '-')
+			{
+				return false;
+			}
+			else
+			{
+				options.inputFiles.push_back(arg);
+			}
+		}
+		return options.benchmark || !options.inputFiles.empty();
+	}
+
+	/// \brief Returns the output path of an input file, without extension
+	std::filesystem::path GetOutputBase(const std::filesystem::path &inputFile, const RenderOptions &options)
+	{
+		std::filesystem::path outputBase = options.hasOutputDirectory ? options.outputDirectory / inputFile.filename() : inputFile;
+		return outputBase.replace_extension();
+	}
+
+	//----------------------------------------------------------------------------------------
+	/// Checks that no two input files are written to the same output files, e.g. files with
+	/// the same name from different directories with --output. Files are rendered in
+	/// parallel, so they would overwrite each other's output.
+	/// @brief Checks that all input files have distinct output files.
+	/// @param[in] options						The command line options
+	/// @return												True if all output files are distinct
+	//----------------------------------------------------------------------------------------
+	bool CheckOutputCollisions(const RenderOptions &options)
+	{
+		std::set<std::filesystem::path> outputBases;
+		bool distinct = true;
+		for (const std::filesystem::path &inputFile : options.inputFiles)
+		{
+			const std::filesystem::path outputBase = std::filesystem::absolute(GetOutputBase(inputFile, options)).lexically_normal();
+			if (!outputBases.insert(outputBase).second)
+			{
+				std::cerr << inputFile.string() << ": output " << outputBase.string() << " is already written for another input file" << std::endl;
+				distinct = false;
+			}
+		}
+		return distinct;
+	}
+
+	/// \brief Renders one chart definition file, returns an error message on failure
+	bool RenderChartFile(const std::filesystem::path &inputFile, const RenderOptions &options, std::string &error)
+	{
+		using namespace SplineDataChartRender;
+
+		std::ifstream inputStream(inputFile);
+		if (!inputStream)
+		{
+			error = "could not open file";
+			return false;
+		}
+
+		ChartDefinition chart;
+		if (!ParseChartDefinition(inputStream, chart, error))
+			return false;
+
+		std::filesystem::path outputBase = GetOutputBase(inputFile, options);
+
+		std::ofstream svgStream(outputBase.replace_extension(".svg"), std::ios::binary);
+		if (!svgStream || !WriteChartSvg(chart, svgStream))
+		{
+			error = "could not write " + outputBase.string();
+			return false;
+		}
+
+		if (options.writePolylines)
+		{
+			std::ofstream polylineStream(outputBase.replace_extension(".bin"), std::ios::binary);
+			if (!polylineStream || !WriteChartPolylines(chart, polylineStream))
+			{
+				error = "could not write " + outputBase.string();
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+
+int main(int argc, char *argv[])
+{
+	RenderOptions options;
+	if (!ParseArguments(argc, argv, options))
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	if (options.benchmark)
+		return SplineDataChartRender::RunBenchmarks(std::cout, BENCHMARK_SAMPLES, BENCHMARK_REPETITIONS) ? 0 : 1;
+
+	if (!CheckOutputCollisions(options))
+		return 1;
+
+	if (options.hasOutputDirectory)
+	{
+		std::error_code errorCode;
+		std::filesystem::create_directories(options.outputDirectory, errorCode);
+		if (errorCode)
+		{
+			std::cerr << options.outputDirectory.string() << ": " << errorCode.message() << std::endl;
+			return 1;
+		}
+	}
+
+	// Files are rendered in parallel, each worker picks the next unrendered file
+	const uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	const uint32_t threadCount = std::min(options.threadCount > 0 ? options.threadCount : hardwareThreads, (uint32_t)options.inputFiles.size());
+
+	std::atomic<size_t> nextFileIndex(0);
+	std::atomic<uint32_t> failedCount(0);
+	std::mutex errorMutex;
+
+	auto worker = [&]()
+	{
+		for (size_t fileIndex = nextFileIndex++; fileIndex < options.inputFiles.size(); fileIndex = nextFileIndex++)
+		{
+			const std::filesystem::path &inputFile = options.inputFiles[fileIndex];
+			std::string error;
+			if (!RenderChartFile(inputFile, options, error))
+			{
+				++failedCount;
+				std::lock_guard<std::mutex> lock(errorMutex);
+				std::cerr << inputFile.string() << ": " << error << std::endl;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount);
+	for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+		threads.emplace_back(worker);
+	for (std::thread &thread : threads)
+		thread.join();
+
+	return failedCount > 0 ? 1 : 0;
+}